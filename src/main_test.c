@@ -8,6 +8,7 @@
 #include "lr_test.h"
 #include "regex_test.h"
 #include "getopt_test.h"
+#include "stone_test.h"
 
 #define FAIL "[\x1b[41;30;1mFAIL\x1b[0m]\t"
 #define PASS "[\x1b[32;1mPASS\x1b[0m]\t"
@@ -20,6 +21,7 @@ int main() {
 	test_lr();
 	test_regex();
 	test_getopt();
+	test_stone();
 
 	summarize();
 	return 0;
@@ -98,21 +98,39 @@ static void add_path(struct nfa *nfa, long source, long dst, int idx);
 
 struct nfa *nfa_compile(struct arena *arena, char *string) {
 	struct nfa *ret;
-	long start, end;
+	long start;
+
+	ret = nfa_new(arena);
+	start = nfa_add(ret, string, 1);
+	if (start < 0) {
+		return NULL;
+	}
+
+	ret->start_node = start;
+	return ret;
+}
+
+struct nfa *nfa_new(struct arena *arena) {
+	struct nfa *ret;
 
 	ret = arena_malloc(arena, sizeof(*ret));
 	ret->arena = arena;
 	ret->num_nodes = 0;
 	ret->alloc = 32;
+	ret->start_node = -1;
 	ret->nodes = arena_malloc(arena, ret->alloc * sizeof(*ret->nodes));
+	return ret;
+}
 
-	if (compile_global(ret, string, strlen(string), &start, &end)) {
-		return NULL;
+long nfa_add(struct nfa *nfa, char *string, int tag) {
+	long start, end;
+
+	if (compile_global(nfa, string, strlen(string), &start, &end)) {
+		return -1;
 	}
 
-	ret->start_node = start;
-	ret->nodes[end].should_accept = 1;
-	return ret;
+	nfa->nodes[end].should_accept = tag;
+	return start;
 }
 
 static int compile_global(struct nfa *nfa, char *string, long len,
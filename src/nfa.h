@@ -16,6 +16,7 @@ struct nfa_list {
 };
 
 struct nfa_node {
+	/* 0 if this isn't an accept state, otherwise the tag given to nfa_add */
 	int should_accept;
 	struct nfa_list *transitions[NFA_MAX_TRANSITIONS];
 };
@@ -31,4 +32,11 @@ struct nfa {
 
 struct nfa *nfa_compile(struct arena *arena, char *string);
 
+/* nfa_new and nfa_add are used to compile several regexes into one nfa
+ *
+ * nfa_add returns the start node of the new regex, or -1 on error. the accept
+ * node of the regex gets should_accept = tag, so tag should be non-zero. */
+struct nfa *nfa_new(struct arena *arena);
+long nfa_add(struct nfa *nfa, char *string, int tag);
+
 #endif
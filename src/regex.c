@@ -19,6 +19,23 @@ static void followups(struct state *state, void *arg, char *ret);
 
 static long state_accepted(struct state *state, void *arg);
 
+/* returns a flag for each node saying if it can reach an accept state */
+static char *find_live(struct arena *arena, struct dfa *dfa);
+
+/* returns the index of the accept list for this state in a regex_set */
+static long state_accepts(struct state *state, void *arg);
+
+/* the builder closure, shared by single regexes and regex sets */
+struct regex_closure {
+	struct nfa *nfa;
+
+	/* these are only used by regex sets */
+	struct regex_set *set;
+	struct state_map *lists;
+	size_t alloc;
+	struct arena *arena;
+};
+
 static struct dfa_builder builder = {
 	enclose,
 	transition,
@@ -27,28 +44,82 @@ static struct dfa_builder builder = {
 	NULL,
 };
 
+static struct dfa_builder set_builder = {
+	enclose,
+	transition,
+	followups,
+	state_accepts,
+	NULL,
+};
+
 struct regex *regex_compile(struct arena *arena, char *pattern) {
 	struct dfa *ret;
 	struct arena *ta;
-	struct nfa *nfa;
+	struct regex_closure closure;
 	struct state *initial_state;
 
 	ta = arena_new();
-	nfa = nfa_compile(ta, pattern);
-	if (nfa == NULL) {
+	closure.nfa = nfa_compile(ta, pattern);
+	closure.set = NULL;
+	if (closure.nfa == NULL) {
 		ret = NULL;
 		goto end;
 	}
 	initial_state = state_new(arena);
-	state_append(initial_state, nfa->start_node);
+	state_append(initial_state, closure.nfa->start_node);
 
-	ret = dfa_new(arena, NFA_CHARSET_SIZE, 0, initial_state, &builder, nfa);
+	ret = dfa_new(arena, NFA_CHARSET_SIZE, 0, initial_state,
+			&builder, &closure);
 
 end:
 	arena_free(ta);
 	return (struct regex *) ret;
 }
 
+struct regex_set *regex_compile_set(struct arena *arena,
+		char **patterns, long len) {
+	struct regex_set *ret;
+	struct arena *ta;
+	struct regex_closure closure;
+	struct state *initial_state, *empty;
+	long i, start;
+
+	ta = arena_new();
+	ret = arena_malloc(arena, sizeof(*ret));
+
+	closure.nfa = nfa_new(ta);
+	closure.set = ret;
+	closure.lists = state_map_new(ta);
+	closure.alloc = 32;
+	closure.arena = arena;
+
+	ret->num_accepts = 0;
+	ret->accepts = arena_malloc(arena,
+			closure.alloc * sizeof(*ret->accepts));
+
+	/* make sure that the empty list gets index 0 */
+	empty = state_new(ta);
+	state_accepts(empty, &closure);
+
+	initial_state = state_new(arena);
+	for (i = 0; i < len; ++i) {
+		/* tags have to be non-zero, so pattern i gets tag i+1 */
+		start = nfa_add(closure.nfa, patterns[i], i+1);
+		if (start < 0) {
+			ret = NULL;
+			goto end;
+		}
+		state_append(initial_state, start);
+	}
+
+	ret->dfa = dfa_new(arena, NFA_CHARSET_SIZE, 0, initial_state,
+			&set_builder, &closure);
+
+end:
+	arena_free(ta);
+	return ret;
+}
+
 long regex_nongreedy_match(struct regex *regex, char *str) {
 	struct dfa *dfa;
 	long i, state;
@@ -93,6 +164,134 @@ long regex_greedy_match(struct regex *regex, char *str) {
 	return r;
 }
 
+long regex_fixed_length(struct regex *regex) {
+	struct dfa *dfa;
+	struct arena *ta;
+	long *depth, *queue, head, tail, i, c, dst, len;
+	char *live;
+
+	dfa = (struct dfa *) regex;
+	ta = arena_new();
+	live = find_live(ta, dfa);
+	depth = arena_malloc(ta, dfa->num_nodes * sizeof(*depth));
+	queue = arena_malloc(ta, dfa->num_nodes * sizeof(*queue));
+	for (i = 0; i < dfa->num_nodes; ++i) {
+		depth[i] = -1;
+	}
+
+	/* the length is fixed if every live node is the same distance from
+	 * the start on every path, and every accept state is at the same
+	 * distance */
+	len = -1;
+	if (!live[0]) {
+		goto end;
+	}
+	depth[0] = 0;
+	queue[0] = 0;
+	head = 0;
+	tail = 1;
+	while (head < tail) {
+		i = queue[head++];
+		if (dfa->nodes[i].r != 0) {
+			if (len >= 0 && len != depth[i]) {
+				len = -1;
+				goto end;
+			}
+			len = depth[i];
+		}
+		for (c = 0; c < dfa->num_items; ++c) {
+			dst = dfa->nodes[i].links[c];
+			if (dst < 0 || dst >= dfa->num_nodes || !live[dst]) {
+				continue;
+			}
+			if (depth[dst] < 0) {
+				depth[dst] = depth[i] + 1;
+				queue[tail++] = dst;
+			} else if (depth[dst] != depth[i] + 1) {
+				len = -1;
+				goto end;
+			}
+		}
+	}
+
+end:
+	arena_free(ta);
+	return len;
+}
+
+char *regex_literal(struct arena *arena, struct regex *regex) {
+	struct dfa *dfa;
+	struct arena *ta;
+	char *live, *ret;
+	long i, c, dst, next, len;
+
+	dfa = (struct dfa *) regex;
+	ta = arena_new();
+	live = find_live(ta, dfa);
+	ret = arena_malloc(arena, dfa->num_nodes + 1);
+
+	/* there's one string if there's one way forward from every node on
+	 * the way to an accept state, and nothing after it */
+	len = 0;
+	i = 0;
+	for (;;) {
+		if (!live[i] || len >= dfa->num_nodes) {
+			ret = NULL;
+			break;
+		}
+		next = -1;
+		for (c = 0; c < dfa->num_items; ++c) {
+			dst = dfa->nodes[i].links[c];
+			if (dst < 0 || dst >= dfa->num_nodes || !live[dst]) {
+				continue;
+			}
+			if (next >= 0 || c == 0 || dfa->nodes[i].r != 0) {
+				next = -2;
+				break;
+			}
+			next = dst;
+			ret[len] = (char) c;
+		}
+		if (next == -2) {
+			ret = NULL;
+			break;
+		}
+		if (next == -1) {
+			ret[len] = '\0';
+			break;
+		}
+		++len;
+		i = next;
+	}
+
+	arena_free(ta);
+	return ret;
+}
+
+static char *find_live(struct arena *arena, struct dfa *dfa) {
+	char *live;
+	long i, c, dst;
+	int changed;
+
+	live = arena_malloc(arena, dfa->num_nodes);
+	for (i = 0; i < dfa->num_nodes; ++i) {
+		live[i] = dfa->nodes[i].r != 0;
+	}
+	do {
+		changed = 0;
+		for (i = 0; i < dfa->num_nodes; ++i) {
+			for (c = 0; !live[i] && c < dfa->num_items; ++c) {
+				dst = dfa->nodes[i].links[c];
+				if (dst >= 0 && dst < dfa->num_nodes &&
+						live[dst]) {
+					live[i] = changed = 1;
+				}
+			}
+		}
+	} while (changed);
+	return live;
+}
+
 struct enclose_closure {
 	struct nfa *nfa;
 	struct hashset *added;
@@ -108,7 +307,7 @@ static void enclose(struct state *state, void *arg) {
 	struct nfa *nfa;
 	size_t i;
 
-	nfa = (struct nfa *) arg;
+	nfa = ((struct regex_closure *) arg)->nfa;
 
 	pm_arena = arena_new();
 	tmp_arena = arena_new();
@@ -163,7 +362,7 @@ static struct state *transition(struct arena *arena,
 	long node;
 	struct nfa *nfa;
 
-	nfa = (struct nfa *) arg;
+	nfa = ((struct regex_closure *) arg)->nfa;
 
 	ret = state_new(arena);
 	state_iter = state->head;
@@ -186,7 +385,7 @@ static void followups(struct state *state, void *arg, char *ret) {
 	long i;
 
 	memset(ret, 0, NFA_CHARSET_SIZE);
-	nfa = (struct nfa *) arg;
+	nfa = ((struct regex_closure *) arg)->nfa;
 
 	iter = state->head;
 	while (iter != NULL) {
@@ -203,7 +402,7 @@ static long state_accepted(struct state *state, void *arg) {
 	struct state_item *iter;
 	struct nfa *nfa;
 
-	nfa = (struct nfa *) arg;
+	nfa = ((struct regex_closure *) arg)->nfa;
 
 	iter = state->head;
 	while (iter != NULL) {
@@ -214,3 +413,58 @@ static long state_accepted(struct state *state, void *arg) {
 	}
 	return 0;
 }
+
+static long state_accepts(struct state *state, void *arg) {
+	struct regex_closure *closure;
+	struct regex_set *set;
+	struct state_item *iter;
+	struct state *list;
+	struct arena *ta;
+	long ret, n, *items;
+	int tag;
+
+	closure = (struct regex_closure *) arg;
+	set = closure->set;
+
+	/* the accept list is itself a sorted set of pattern indices, so we can
+	 * dedupe them with a state_map */
+	ta = arena_new();
+	list = state_new(ta);
+	iter = state->head;
+	while (iter != NULL) {
+		tag = closure->nfa->nodes[iter->value].should_accept;
+		if (tag) {
+			state_append(list, tag-1);
+		}
+		iter = iter->next;
+	}
+
+	ret = state_map_get(closure->lists, list);
+	if (ret >= 0) {
+		goto end;
+	}
+
+	n = 0;
+	for (iter = list->head; iter != NULL; iter = iter->next) {
+		++n;
+	}
+	items = arena_malloc(closure->arena, (n+1) * sizeof(*items));
+	n = 0;
+	for (iter = list->head; iter != NULL; iter = iter->next) {
+		items[n++] = iter->value;
+	}
+	items[n] = -1;
+
+	if (set->num_accepts >= (long) closure->alloc) {
+		closure->alloc *= 2;
+		set->accepts = arena_realloc(set->accepts,
+				closure->alloc * sizeof(*set->accepts));
+	}
+	ret = set->num_accepts++;
+	set->accepts[ret] = items;
+
+	state_map_put(closure->lists, list, ret);
+end:
+	arena_free(ta);
+	return ret;
+}
@@ -1,15 +1,40 @@
 #ifndef REGEX_H
 #define REGEX_H
 
+#include "dfa.h"
 #include "arena.h"
 
 /* a struct regex is just a struct dfa */
 struct regex;
 
+/* several regexes compiled into a single dfa */
+struct regex_set {
+	struct dfa *dfa;
+
+	/* the r value of each dfa node is an index into `accepts`, which is a
+	 * list of the patterns accepted by that node. each list is sorted in
+	 * ascending order and terminated by -1. accepts[0] is always the empty
+	 * list. */
+	long **accepts;
+	long num_accepts;
+};
+
 struct regex *regex_compile(struct arena *arena, char *str);
 
+/* returns NULL if any of the patterns fail to compile */
+struct regex_set *regex_compile_set(struct arena *arena,
+		char **patterns, long len);
+
 /* returns the length of a match starting from the beginning of str */
 long regex_nongreedy_match(struct regex *regex, char *str);
 long regex_greedy_match(struct regex *regex, char *str);
 
+/* returns the length of every string the regex matches, or -1 if they don't
+ * all have the same length */
+long regex_fixed_length(struct regex *regex);
+
+/* returns the only string the regex matches, or NULL if it matches more than
+ * one, or none, or if the string has a '\0' in it */
+char *regex_literal(struct arena *arena, struct regex *regex);
+
 #endif
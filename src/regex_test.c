@@ -1,11 +1,19 @@
+#include <string.h>
+
 #include "arena.h"
 #include "regex.h"
 
 #include "main_test.h"
 #include "regex_test.h"
 
+static void test_regex_set(void);
 static int regex_matches(char *regex, char *str);
 
+/* returns the nth pattern accepted after reading str, or -1 */
+static long set_accepts(struct regex_set *set, char *str, long n);
+static long fixed_length(char *regex);
+static int is_literal(char *regex, char *str);
+
 void test_regex(void) {
 	assert(regex_matches("a*b", "aaaab"));
 	assert(!regex_matches("a*b", "aaaac"));
@@ -45,6 +53,92 @@ void test_regex(void) {
 	assert(!regex_matches("[^abc]", "a"));
 	assert(regex_matches("", ""));
 	assert(!regex_matches("", "a"));
+
+	assert(fixed_length("abc") == 3);
+	assert(fixed_length("a[0-9]|bc") == 2);
+	assert(fixed_length("(ab){2}") == 4);
+	assert(fixed_length("") == 0);
+	assert(fixed_length("ab?") == -1);
+	assert(fixed_length("a*") == -1);
+	assert(fixed_length("a|bc") == -1);
+
+	assert(is_literal("while", "while"));
+	assert(is_literal("(ab)c", "abc"));
+	assert(is_literal("a{3}", "aaa"));
+	assert(is_literal("ab?", NULL));
+	assert(is_literal("a|b", NULL));
+	assert(is_literal("a*", NULL));
+	assert(is_literal("", ""));
+
+	test_regex_set();
+}
+
+static void test_regex_set(void) {
+	struct arena *arena;
+	struct regex_set *set;
+	char *patterns[] = { "if", "[a-z]+", "[0-9]+", "i" };
+
+	arena = arena_new();
+	set = regex_compile_set(arena, patterns, LEN(patterns));
+	assert(set != NULL);
+	assert(set_accepts(set, "", 0) == -1);
+	assert(set_accepts(set, "if", 0) == 0);
+	assert(set_accepts(set, "if", 1) == 1);
+	assert(set_accepts(set, "if", 2) == -1);
+	assert(set_accepts(set, "iff", 0) == 1);
+	assert(set_accepts(set, "i", 0) == 1);
+	assert(set_accepts(set, "i", 1) == 3);
+	assert(set_accepts(set, "123", 0) == 2);
+	assert(set_accepts(set, "12a", 0) == -1);
+	arena_free(arena);
+
+	arena = arena_new();
+	patterns[1] = "[a-z";
+	assert(regex_compile_set(arena, patterns, LEN(patterns)) == NULL);
+	arena_free(arena);
+}
+
+static long set_accepts(struct regex_set *set, char *str, long n) {
+	long i, state;
+	long *list;
+
+	state = 0;
+	for (i = 0; str[i]; ++i) {
+		state = set->dfa->nodes[state].links[(unsigned char) str[i]];
+		if (state < 0) {
+			return -1;
+		}
+	}
+	list = set->accepts[set->dfa->nodes[state].r];
+	for (i = 0; i < n; ++i) {
+		if (list[i] == -1) {
+			return -1;
+		}
+	}
+	return list[n];
+}
+
+static long fixed_length(char *regex) {
+	struct arena *arena;
+	long len;
+
+	arena = arena_new();
+	len = regex_fixed_length(regex_compile(arena, regex));
+	arena_free(arena);
+	return len;
+}
+
+/* returns 1 if regex_literal gives str, where NULL means no string */
+static int is_literal(char *regex, char *str) {
+	struct arena *arena;
+	char *lit;
+	int r;
+
+	arena = arena_new();
+	lit = regex_literal(arena, regex_compile(arena, regex));
+	r = str == NULL ? lit == NULL : lit != NULL && strcmp(lit, str) == 0;
+	arena_free(arena);
+	return r;
 }
 
 static int regex_matches(char *regex, char *str) {
@@ -20,6 +20,7 @@ static int parse_definitions(struct stone_parse_state *state,
 static int parse_definition_line(struct stone_parse_state *state,
 		FILE *output);
 static int parse_substitution(struct stone_parse_state *state);
+static int parse_options(struct stone_parse_state *state, FILE *output);
 static int read_states(struct arena *arena,
 		char *line, char ***states, size_t *len, size_t *alloc);
 
@@ -37,6 +38,11 @@ static int read_escape(char *s, char *ret);
 static int read_octal(char *s, char *ret);
 static int read_hex(char *s, char *ret);
 static int is_skip(char *s);
+static int read_conds(struct stone_parse_state *state,
+		struct stone_parse_rule *rule);
+static char *read_trail(struct arena *arena, struct stone_parse_rule *rule);
+static int find_keywords(struct stone_parse_state *state);
+static int compile_scanners(struct stone_parse_state *state);
 
 /* helper functions */
 static char *strdup(struct arena *arena, char *s);
@@ -55,6 +61,9 @@ static int parse_definitions(struct stone_parse_state *state,
 
 	state->substitutions = strmap_new(state->arena);
 	state->output_size = 3000;
+	state->buffer_size = 65536;
+	state->reentrant = 0;
+	state->lineno = 0;
 
 	state->sh_states_count = 0;
 	state->sh_states_alloc = 32;
@@ -126,6 +135,10 @@ static int parse_definition_line(struct stone_parse_state *state,
 		return -1;
 	}
 
+	if (startswith(state->line, "%option ")) {
+		return parse_options(state, output);
+	}
+
 	switch (state->line[1]) {
 	case 'p': case 'n': case 'a': case 'e': case 'k':
 		return -1;
@@ -202,6 +215,52 @@ static int parse_substitution(struct stone_parse_state *state) {
 	return -1;
 }
 
+/* parses a line like "%option bufsize=4096"
+ *
+ * flex puts most of its options here, and it seemed like the least surprising
+ * place for ours to go */
+static int parse_options(struct stone_parse_state *state, FILE *output) {
+	char *s;
+	long len;
+
+	s = state->line + strlen("%option");
+	for (;;) {
+		while (*s == ' ') {
+			++s;
+		}
+		if (*s == '\0') {
+			return -1;
+		}
+		for (len = 0; s[len] != ' ' && s[len] != '\0'; ++len) ;
+
+		if (startswith(s, "bufsize=")) {
+			state->buffer_size = atol(s + strlen("bufsize="));
+			if (state->buffer_size <= 0) {
+				report(ERROR, "Invalid buffer size\n");
+				return 1;
+			}
+		} else if (len == (long) strlen("reentrant") &&
+				startswith(s, "reentrant")) {
+			/* yyscan_t is declared right away so that the code in
+			 * the rest of the definitions section can use it */
+			if (!state->reentrant) {
+				fputs("struct yyguts;\n"
+					"typedef struct yyguts *yyscan_t;\n",
+					output);
+			}
+			state->reentrant = 1;
+		} else if (len == (long) strlen("yylineno") &&
+				startswith(s, "yylineno")) {
+			state->lineno = 1;
+		} else {
+			report(ERROR, "Unknown option %.*s\n", (int) len, s);
+			return 1;
+		}
+
+		s += len;
+	}
+}
+
 static int read_states(struct arena *arena,
 		char *line, char ***states, size_t *len, size_t *alloc) {
 	long i;
@@ -383,27 +442,32 @@ skip_parse:
 		}
 	}
 
+	state->patterns = arena_malloc(state->arena,
+			(state->rules_count+1) * sizeof(*state->patterns));
 	for (state->i = 0; state->i < state->rules_count; ++state->i) {
-#define this_action (state->rules[state->i])
-		this_action->re_dfa = (struct dfa *)
-			regex_compile(state->arena, this_action->re);
-		if (this_action->re_dfa == NULL) {
-			fputs("Failed to compile regex\n", stderr);
+		state->patterns[state->i] = read_trail(state->arena,
+				state->rules[state->i]);
+		if (state->patterns[state->i] == NULL) {
+			fputs("Failed to compile trailing context\n", stderr);
 			COROUTINE_RET(1);
 		}
-		if (this_action->trail == NULL) {
-			this_action->trail_dfa = NULL;
-			continue;
-		}
-		this_action->trail_dfa = (struct dfa *)
-			regex_compile(state->arena, this_action->trail);
-		if (this_action->trail_dfa == NULL) {
-			fputs("Failed to compile trailing context\n", stderr);
+	}
+
+	for (state->i = 0; state->i < state->rules_count; ++state->i) {
+#define this_action (state->rules[state->i])
+		if (read_conds(state, this_action)) {
+			fprintf(stderr, "Unknown start condition in <%s>\n",
+					this_action->states);
 			COROUTINE_RET(1);
 		}
 #undef this_action
 	}
 
+	if (find_keywords(state) || compile_scanners(state)) {
+		fputs("Failed to compile regex\n", stderr);
+		COROUTINE_RET(1);
+	}
+
 	COROUTINE_RET(-1);
 	COROUTINE_END;
 }
@@ -433,11 +497,12 @@ static struct stone_parse_rule *read_ere(struct arena *arena,
 static int read_ere_help(struct arena *arena,
 		struct stone_parse_rule *rule, struct sb *sb,
 		char *ere, struct strmap *substs) {
-	long i, d;
+	long i, d, t;
 	int in_q;
 	char c;
 
 	in_q = 0;
+	t = -1;
 
 	if (rule != NULL) {
 		rule->re = NULL;
@@ -496,6 +561,12 @@ static int read_ere_help(struct arena *arena,
 		}
 not_subst:
 
+		if (in_q && (ere[i] == '$' || ere[i] == '/')) {
+			/* only operators outside of quotes */
+			sb_append(sb, ere[i]);
+			continue;
+		}
+
 		switch (ere[i]) {
 		case '$':
 			if (rule == NULL) {
@@ -508,7 +579,7 @@ not_subst:
 				return 1;
 			}
 			sb_append(sb, '\0');
-			rule->trail = sb_read(sb) + sb->len;
+			t = (long) sb->len;
 			continue;
 		case '\\':
 			break;
@@ -535,6 +606,9 @@ not_subst:
 	if (rule != NULL) {
 		rule->re = sb_read(sb);
 		rule->action = ere + i;
+		if (t >= 0) {
+			rule->trail = rule->re + t;
+		}
 	}
 
 	return 0;
@@ -673,7 +747,7 @@ static int read_hex(char *s, char *ret) {
 }
 
 static int is_skip(char *s) {
-	while (*s != '\0' && isspace(*s)) {
+	while (*s != '\0' && isspace((unsigned char) *s)) {
 		++s;
 	}
 
@@ -681,13 +755,231 @@ static int is_skip(char *s) {
 		return 0;
 	}
 
-	while (*s != '\0' && isspace(*s)) {
+	while (*s != '\0' && isspace((unsigned char) *s)) {
 		++s;
 	}
 
 	return *s == '\0';
 }
 
+/* fills in rule->conds from rule->states, returns 1 on error */
+static int read_conds(struct stone_parse_state *state,
+		struct stone_parse_rule *rule) {
+	size_t i, n, len;
+	char *s, *name;
+
+	n = state->sh_states_count + state->ex_states_count;
+	rule->conds = arena_malloc(state->arena, n);
+
+	/* rules without a start condition are active in every shared state */
+	if (rule->states == NULL) {
+		for (i = 0; i < n; ++i) {
+			rule->conds[i] = i < state->sh_states_count;
+		}
+		return 0;
+	}
+
+	memset(rule->conds, 0, n);
+	s = rule->states;
+	while (*s != '\0') {
+		for (len = 0; s[len] != '\0' && s[len] != ','; ++len) ;
+		for (i = 0; i < n; ++i) {
+			name = i < state->sh_states_count ?
+				state->sh_states[i] :
+				state->ex_states[i - state->sh_states_count];
+			if (strlen(name) == len && memcmp(name, s, len) == 0) {
+				break;
+			}
+		}
+		if (i >= n) {
+			return 1;
+		}
+		rule->conds[i] = 1;
+		s += len;
+		if (*s == ',') {
+			++s;
+		}
+	}
+	return 0;
+}
+
+/* returns the pattern that goes in the scanner for this rule, which is the
+ * regex followed by its trailing context, or NULL on error. this also fills
+ * in the rule's trail_len, head_len, head_dfa and trail_dfa. */
+static char *read_trail(struct arena *arena, struct stone_parse_rule *rule) {
+	struct sb *sb;
+	char *s;
+
+	rule->trail_len = rule->head_len = -1;
+	rule->head_dfa = rule->trail_dfa = NULL;
+	if (rule->trail == NULL) {
+		return rule->re;
+	}
+
+	rule->trail_dfa = (struct dfa *) regex_compile(arena, rule->trail);
+	rule->head_dfa = (struct dfa *) regex_compile(arena, rule->re);
+	if (rule->trail_dfa == NULL || rule->head_dfa == NULL) {
+		return NULL;
+	}
+
+	/* the scanner only needs the dfas if neither side has a fixed length,
+	 * which should be rare */
+	rule->trail_len = regex_fixed_length((struct regex *) rule->trail_dfa);
+	if (rule->trail_len < 0) {
+		rule->head_len = regex_fixed_length(
+				(struct regex *) rule->head_dfa);
+	}
+	if (rule->trail_len >= 0 || rule->head_len >= 0) {
+		rule->head_dfa = rule->trail_dfa = NULL;
+	}
+
+	sb = sb_new(arena);
+	sb_append(sb, '(');
+	for (s = rule->re; *s != '\0'; ++s) {
+		sb_append(sb, *s);
+	}
+	sb_append(sb, ')');
+	sb_append(sb, '(');
+	for (s = rule->trail; *s != '\0'; ++s) {
+		sb_append(sb, *s);
+	}
+	sb_append(sb, ')');
+	return sb_read(sb);
+}
+
+/* keywords like "while" usually come before an identifier rule that matches
+ * them too. they're left out of the dfa, and the scanner looks the string up
+ * whenever the identifier rule matches. that only works if nothing between the
+ * two could match the keyword, and if they match in the same places. returns 1
+ * on error. */
+static int find_keywords(struct stone_parse_state *state) {
+	struct regex **res;
+	struct stone_parse_rule *k, *g;
+	size_t i, j, n;
+
+	for (i = 0; i < state->rules_count; ++i) {
+		state->rules[i]->literal = NULL;
+		state->rules[i]->general = -1;
+	}
+	if (has_reject(state)) {
+		return 0;
+	}
+
+	res = arena_malloc(state->arena,
+			(state->rules_count+1) * sizeof(*res));
+	for (i = 0; i < state->rules_count; ++i) {
+		res[i] = regex_compile(state->arena, state->patterns[i]);
+		if (res[i] == NULL) {
+			return 1;
+		}
+		if (state->rules[i]->trail == NULL &&
+				!state->rules[i]->anchored) {
+			state->rules[i]->literal = regex_literal(state->arena,
+					res[i]);
+		}
+	}
+
+	for (i = 0; i < state->rules_count; ++i) {
+		k = state->rules[i];
+		if (k->literal == NULL || k->literal[0] == '\0') {
+			continue;
+		}
+
+		/* the general rule is the next one to match the keyword */
+		n = strlen(k->literal);
+		for (j = i+1; j < state->rules_count; ++j) {
+			if (regex_greedy_match(res[j], k->literal) == (long) n) {
+				break;
+			}
+		}
+		if (j == state->rules_count) {
+			continue;
+		}
+		g = state->rules[j];
+		if (g->literal != NULL || g->trail != NULL || g->anchored ||
+				memcmp(k->conds, g->conds,
+				state->sh_states_count +
+				state->ex_states_count) != 0) {
+			continue;
+		}
+		k->general = (long) j;
+	}
+
+	/* keywords that can't be put in a table are left in the dfa */
+	if (has_keywords(state) && !layout_keywords(state)) {
+		for (i = 0; i < state->rules_count; ++i) {
+			state->rules[i]->general = -1;
+		}
+	}
+	return 0;
+}
+
+/* returns 1 if rule k can match from entry e, see compile_scanners */
+#define IN_ENTRY(state, k, e) ((state)->rules[k]->general < 0 && \
+		(state)->rules[k]->conds[(e) / 2] && \
+		((e) % 2 || !(state)->rules[k]->anchored))
+
+/* compiles a dfa for each start condition, and another for when it's at the
+ * beginning of a line and '^' rules can match. entry 2*i is start condition i
+ * in the middle of a line and 2*i+1 is the same at the start of one. entries
+ * with the same rules share a dfa. returns 1 on error. */
+static int compile_scanners(struct stone_parse_state *state) {
+	size_t nentries, i, j, k;
+	long n;
+	char **patterns;
+
+	nentries = 2 * (state->sh_states_count + state->ex_states_count);
+	state->scanners = arena_malloc(state->arena,
+			nentries * sizeof(*state->scanners));
+	state->scanner_rules = arena_malloc(state->arena,
+			nentries * sizeof(*state->scanner_rules));
+	state->cond_scanner = arena_malloc(state->arena,
+			nentries * sizeof(*state->cond_scanner));
+	state->num_scanners = 0;
+
+	for (i = 0; i < nentries; ++i) {
+		for (j = 0; j < i; ++j) {
+			for (k = 0; k < state->rules_count; ++k) {
+				if (IN_ENTRY(state, k, i) !=
+						IN_ENTRY(state, k, j)) {
+					break;
+				}
+			}
+			if (k == state->rules_count) {
+				break;
+			}
+		}
+		if (j < i) {
+			state->cond_scanner[i] = state->cond_scanner[j];
+			continue;
+		}
+
+		patterns = arena_malloc(state->arena,
+				(state->rules_count+1) * sizeof(*patterns));
+		state->scanner_rules[state->num_scanners] = arena_malloc(
+				state->arena, (state->rules_count+1) *
+				sizeof(**state->scanner_rules));
+		n = 0;
+		for (k = 0; k < state->rules_count; ++k) {
+			if (IN_ENTRY(state, k, i)) {
+				state->scanner_rules[state->num_scanners][n] =
+					(long) k;
+				patterns[n++] = state->patterns[k];
+			}
+		}
+
+		state->scanners[state->num_scanners] = regex_compile_set(
+				state->arena, patterns, n);
+		if (state->scanners[state->num_scanners] == NULL) {
+			return 1;
+		}
+		state->cond_scanner[i] = state->num_scanners++;
+	}
+	return 0;
+}
+
+#undef IN_ENTRY
+
 /* end of rules section parse definitions */
 
 static char *strdup(struct arena *arena, char *s) {
@@ -6,6 +6,7 @@
 #include "sb.h"
 #include "dfa.h"
 #include "arena.h"
+#include "regex.h"
 
 struct stone_parse_rule {
 	char *re;       /* the regex itself */
@@ -16,10 +17,30 @@ struct stone_parse_rule {
 
 	char *action;
 
-	struct dfa *re_dfa;
+	/* a rule with trailing context is compiled as the regex followed by
+	 * the context. if the context always has the same length, trail_len
+	 * is that length and the token is the match minus that many bytes.
+	 * otherwise, if the regex always has the same length, head_len is
+	 * that length. both are -1 if neither is fixed, and then head_dfa and
+	 * trail_dfa are used to find where the context begins. */
+	long trail_len;
+	long head_len;
+	struct dfa *head_dfa;
 	struct dfa *trail_dfa;
 
+	/* if the regex only matches one string and a later, more general rule
+	 * can match that string instead, then general is the index of that
+	 * rule and the scanner looks the string up after it matches.
+	 * otherwise general is -1. */
+	char *literal;
+	long general;
+
 	char *states;
+
+	/* conds[i] is 1 if this rule is active in start condition i, where the
+	 * start conditions are numbered in the same order as they are
+	 * #defined in the output */
+	char *conds;
 };
 
 struct stone_parse_state {
@@ -58,6 +79,11 @@ struct stone_parse_state {
 
 	struct strmap *substitutions;
 	long output_size;
+	long buffer_size;
+	int reentrant;
+	int lineno; /* 1 with %option yylineno */
+	int memo; /* 1 if the scanner needs a memo to run in linear time */
+	int accel; /* 1 if some states can skip ahead, see find_accel_states */
 
 	/* shared states, defined with %s */
 	char **sh_states;
@@ -73,6 +99,26 @@ struct stone_parse_state {
 	struct stone_parse_rule **rules;
 	size_t rules_count;
 	size_t rules_alloc;
+
+	/* the rules active in each start condition are compiled into a dfa,
+	 * once with the '^' rules for the start of a line and once without,
+	 * and entries with the same rules share one. start condition i uses
+	 * scanners[cond_scanner[2*i]], or scanners[cond_scanner[2*i+1]] at the
+	 * start of a line. pattern j of scanners[k] is rule
+	 * scanner_rules[k][j], and patterns[i] is the pattern for rule i. */
+	char **patterns;
+	struct regex_set **scanners;
+	long **scanner_rules;
+	long num_scanners;
+	long *cond_scanner;
+
+	/* the perfect hash table for keywords, see layout_keywords. rule i
+	 * goes in slot kw_slot[i] of kw_size, and kw_seeds has a seed for each
+	 * of the kw_buckets buckets. */
+	long *kw_slot;
+	unsigned long *kw_seeds;
+	long kw_buckets;
+	long kw_size;
 };
 
 /* this is a coroutine, see coroutine.h */
@@ -0,0 +1,950 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "coroutine.h"
+#include "stone-parse.h"
+
+#include "main_test.h"
+#include "stone_test.h"
+
+/* the generated scanners are built and run in the object directory */
+#define SCAN_DIR "work/"
+
+/* what the extensions that use posix functions need in strict ansi mode */
+#define POSIX_FLAGS "-D_POSIX_C_SOURCE=200112L"
+
+static void test_yymap(void);
+static void test_reentrant(void);
+static void test_batch(void);
+static void test_scan_string(void);
+static void test_scan_unput(void);
+static void test_memo(void);
+static void test_yyless_lineno(void);
+static void test_reject(void);
+static void test_reject_shorter(void);
+static void test_trail(void);
+static void test_trail_quoted(void);
+static void test_yyless(void);
+static void test_start_conds(void);
+static void test_bol(void);
+static void test_accel(void);
+static void test_keywords(void);
+static void test_push(void);
+static void test_push_pointer(void);
+static void test_include(void);
+static void test_include_nested(void);
+static void test_stats(void);
+static void test_readahead(void);
+static void test_uring(void);
+static void test_files(void);
+
+static int scan_matches(char **lex, char *cflags, char *input,
+		char *expected);
+static int write_file(char *path, char *s);
+static int file_contains(char *path, char *s);
+
+void test_stone(void) {
+	test_yymap();
+	test_reentrant();
+	test_batch();
+	test_scan_string();
+	test_scan_unput();
+	test_memo();
+	test_yyless_lineno();
+	test_reject();
+	test_reject_shorter();
+	test_trail();
+	test_trail_quoted();
+	test_yyless();
+	test_start_conds();
+	test_bol();
+	test_accel();
+	test_keywords();
+	test_push();
+	test_push_pointer();
+	test_include();
+	test_include_nested();
+	test_stats();
+	test_readahead();
+	test_uring();
+	test_files();
+}
+
+/* mapped files are lexed in place, and writing to them through unput() and
+ * %pointer mode doesn't change the file */
+static void test_yymap(void) {
+	static char *lex[] = {
+		"%pointer\n",
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"[a-z]+ printf(\"%s \", yytext);\n",
+		"[0-9] unput('x');\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) {\n",
+		"	FILE *f;\n",
+		"	char buf[64];\n",
+		"	size_t n;\n",
+		"	if (yymap(0) != 0) return 1;\n",
+		"	while (yylex() > 0) ;\n",
+		"	if (yymap_path(\"" SCAN_DIR "scan.inc\") != 0) ",
+		"return 1;\n",
+		"	while (yylex() > 0) ;\n",
+		"	f = fopen(\"" SCAN_DIR "scan.inc\", \"r\");\n",
+		"	if (f == NULL) return 1;\n",
+		"	n = fread(buf, 1, sizeof(buf) - 1, f);\n",
+		"	buf[n] = '\\0';\n",
+		"	printf(\"| %s\", buf);\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(write_file(SCAN_DIR "scan.inc", "in 9 file\n"));
+	assert(scan_matches(lex, POSIX_FLAGS, "one 2 two\n",
+			"one x two in x file | in 9 file\n"));
+}
+
+/* two scanners lexed in turns keep their own start conditions and yyextra */
+static void test_reentrant(void) {
+	static char *lex[] = {
+		"%option reentrant\n",
+		"%x Q\n",
+		" #include <stdio.h>\n",
+		" int yywrap(yyscan_t yyscanner);\n",
+		"%%\n",
+		"\\\" BEGIN Q;\n",
+		"<Q>\\\" BEGIN INITIAL;\n",
+		"[a-z]+ { ++*(int *) yyextra; return 1; }\n",
+		"<Q>[a-z]+ return 2;\n",
+		".|\\n ;\n",
+		"<Q>.|\\n ;\n",
+		"%%\n",
+		"int yywrap(yyscan_t yyscanner) {\n",
+		"	(void) yyscanner;\n",
+		"	return 1;\n",
+		"}\n",
+		"int main(void) {\n",
+		"	yyscan_t a, b;\n",
+		"	char sa[] = \"x \\\"in q\\\" y\";\n",
+		"	char sb[] = \"\\\"p\\\" r s\";\n",
+		"	int na = 0, nb = 0, ra = 1, rb = 1;\n",
+		"	if (yylex_init(&a) != 0 || yylex_init(&b) != 0)\n",
+		"		return 1;\n",
+		"	yyset_extra(&na, a);\n",
+		"	yyset_extra(&nb, b);\n",
+		"	yy_scan_string(sa, a);\n",
+		"	yy_scan_string(sb, b);\n",
+		"	while (ra > 0 || rb > 0) {\n",
+		"		if (ra > 0 && (ra = yylex(a)) > 0)\n",
+		"			printf(\"a%d(%s) \", ra, ",
+		"yyget_text(a));\n",
+		"		if (rb > 0 && (rb = yylex(b)) > 0)\n",
+		"			printf(\"b%d(%s) \", rb, ",
+		"yyget_text(b));\n",
+		"	}\n",
+		"	printf(\"%d %d\\n\", na, nb);\n",
+		"	yylex_destroy(a);\n",
+		"	yylex_destroy(b);\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "",
+			"a1(x) b2(p) a2(in) b1(r) a2(q) b1(s) a1(y) 2 2\n"));
+}
+
+/* yylex_batch stops when the array is full or an action returns, and input
+ * that doesn't match a rule is echoed without a token */
+static void test_batch(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"[a-z]+ ;\n",
+		"[0-9]+ return 7;\n",
+		"\\040 ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) {\n",
+		"	struct yytoken t[2];\n",
+		"	int i, n;\n",
+		"	yyin = stdin;\n",
+		"	while ((n = yylex_batch(t, 2)) > 0) {\n",
+		"		printf(\"%d:\", n);\n",
+		"		for (i = 0; i < n; ++i)\n",
+		"			printf(\" %d/%ld/%d/%d\", t[i].rule, ",
+		"t[i].offset,\n",
+		"				t[i].length, t[i].value);\n",
+		"		printf(\"\\n\");\n",
+		"	}\n",
+		"	printf(\"end %d\\n\", n);\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "ab 12 c;d",
+			"2: 0/0/2/0 2/2/1/0\n"
+			"1: 1/3/2/7\n"
+			"2: 2/5/1/0 0/6/1/0\n"
+			";1: 0/8/1/0\n"
+			"end 0\n"));
+}
+
+/* yy_scan_string and yy_scan_bytes never write to the caller's memory, so
+ * %pointer mode can scan a string literal */
+static void test_scan_string(void) {
+	static char *lex[] = {
+		"%pointer\n",
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"[a-z]+ printf(\"W(%s) \", yytext);\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) {\n",
+		"	yy_scan_string(\"abc def\");\n",
+		"	while (yylex() > 0) ;\n",
+		"	yy_scan_bytes(\"ghi jkl\", 5);\n",
+		"	while (yylex() > 0) ;\n",
+		"	printf(\"\\n\");\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "",
+			"W(abc) W(def) W(ghi) W(j) \n"));
+}
+
+/* unput() after a token doesn't write to the caller's memory either */
+static void test_scan_unput(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"b unput('X');\n",
+		"[a-z] printf(\"%s \", yytext);\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) {\n",
+		"	char s[] = \"zabq\";\n",
+		"	yy_scan_string(s);\n",
+		"	while (yylex() > 0) ;\n",
+		"	printf(\"%s\\n\", s);\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "",
+			"z a Xq zabq\n"));
+}
+
+/* a walk that fails without going through an accept state falls back to
+ * echoing one byte, and it mustn't walk the whole run again from the next
+ * one. the dfa's backup is counted, so the test doesn't depend on timing. */
+static void test_memo(void) {
+	static char *lex[] = {
+		" #define YY_STATS 1\n",
+		" #include <stdio.h>\n",
+		" #include <stdlib.h>\n",
+		" #include <string.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"a*b printf(\"AB\\n\");\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"static unsigned long walk(long n) {\n",
+		"	char *s = malloc(n + 1);\n",
+		"	memset(s, 'a', n);\n",
+		"	s[n] = '\\0';\n",
+		"	memset(yystats(), 0, sizeof(struct yystats));\n",
+		"	yy_scan_string(s);\n",
+		"	while (yylex() > 0) ;\n",
+		"	free(s);\n",
+		"	return yystats()->backup;\n",
+		"}\n",
+		"int main(void) {\n",
+		"	unsigned long a, b;\n",
+		"	yyout = fopen(\"/dev/null\", \"w\");\n",
+		"	a = walk(2000);\n",
+		"	b = walk(8000);\n",
+		"	puts(b < 8 * a ? \"linear\" : \"quadratic\");\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "", "linear\n"));
+}
+
+/* after input(), yyless() puts bytes back with unput(), which mustn't take
+ * the newline off the line count a second time */
+static void test_yyless_lineno(void) {
+	static char *lex[] = {
+		"%option yylineno\n",
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"a\\nb { input(); yyless(1); }\n",
+		"[a-z] printf(\"%d:%d %s\\n\", ",
+		"yylineno, yycolumn, yytext);\n",
+		"\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) { yyin = stdin; ",
+		"while (yylex()) ; return 0; }\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "a\nbX\nc\n", "2:0 b\n3:0 c\n"));
+}
+
+/* REJECT goes on to the next longest match, and then to the next rule */
+static void test_reject(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"abc { printf(\"abc \"); REJECT; }\n",
+		"ab { printf(\"ab \"); REJECT; }\n",
+		"[a-z] printf(\"%s \", yytext);\n",
+		"\\n printf(\"\\n\");\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) { yyin = stdin; ",
+		"while (yylex()) ; return 0; }\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "abcd\n", "abc ab a b c d \n"));
+}
+
+/* REJECT tries the same rule again at the shorter lengths it matches, before
+ * rules that match the same length later on */
+static void test_reject_shorter(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"[a-z]+ { printf(\"W(%s) \", yytext); REJECT; }\n",
+		"[a-z][a-z] printf(\"T(%s) \", yytext);\n",
+		"\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) { yyin = stdin; ",
+		"while (yylex() > 0) ; return 0; }\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "abc\nabcd\n",
+			"W(abc) W(ab) T(ab) W(c) c"
+			"W(abcd) W(abc) W(ab) T(ab) W(cd) T(cd) "));
+}
+
+/* trailing context with a fixed length, and with neither side fixed */
+static void test_trail(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"[a-z]+/[0-9] printf(\"I(%s) \", yytext);\n",
+		"a+/b*c printf(\"A(%s) \", yytext);\n",
+		"[a-z]+ printf(\"W(%s) \", yytext);\n",
+		"[0-9]+ printf(\"N(%s) \", yytext);\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) { yyin = stdin; ",
+		"while (yylex()) ; return 0; }\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "abc1 aab aaabbc zz9\n",
+			"I(abc) N(1) W(aab) A(aaa) W(bbc) I(zz) N(9) "));
+}
+
+/* / and $ are plain characters inside quotes */
+static void test_trail_quoted(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"a\"/\"b printf(\"S(%s) \", yytext);\n",
+		"x\"$\" printf(\"D(%s) \", yytext);\n",
+		"\"/\"/[0-9] printf(\"T(%s) \", yytext);\n",
+		"[a-z]+ printf(\"W(%s) \", yytext);\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) { yyin = stdin; ",
+		"while (yylex() > 0) ; return 0; }\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "a/b ab x$ x /1\n",
+			"S(a/b) W(ab) D(x$) W(x) T(/) "));
+}
+
+/* yyless gives back the end of the token, both when it's still right behind
+ * the input and when input() has read past it */
+static void test_yyless(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"[0-9]+x { yyless(yyleng - 1); ",
+		"printf(\"N(%s) \", yytext); }\n",
+		"x printf(\"X \");\n",
+		"[a-z]+ { if (yyleng > 2) { yyless(2); } ",
+		"printf(\"W(%s) \", yytext); }\n",
+		"#[a-z]+ { input(); yyless(1); printf(\"%s \", yytext); }\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) { yyin = stdin; ",
+		"while (yylex()) ; return 0; }\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "12x abcd #ab!\n",
+			"N(12) X W(ab) W(cd) # W(ab) "));
+}
+
+/* rules with no start condition are active in the inclusive ones, but not in
+ * the exclusive ones, and a rule can be in more than one */
+static void test_start_conds(void) {
+	static char *lex[] = {
+		"%s S\n",
+		"%x X\n",
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"s BEGIN S;\n",
+		"x BEGIN X;\n",
+		"<S,X>i BEGIN INITIAL;\n",
+		"<X>[a-z]+ printf(\"X(%s) \", yytext);\n",
+		"<S>[0-9]+ printf(\"S(%s) \", yytext);\n",
+		"[a-z]+ printf(\"W(%s) \", yytext);\n",
+		"[0-9]+ printf(\"N(%s) \", yytext);\n",
+		".|\\n ;\n",
+		"<X>.|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) {\n",
+		"	yyin = stdin;\n",
+		"	while (yylex() > 0) ;\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "ab 1 s cd 2 i 3 x ef 4 i gh\n",
+			"W(ab) N(1) W(cd) S(2) N(3) X(ef) W(gh) "));
+}
+
+/* ^ rules only match at the start of a line, in start conditions too, and
+ * leave the rest to the same pattern without ^ */
+static void test_bol(void) {
+	static char *lex[] = {
+		"%x C\n",
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"^#[a-z]+ printf(\"D(%s) \", yytext);\n",
+		"#[a-z]+ printf(\"H(%s) \", yytext);\n",
+		"^c BEGIN C;\n",
+		"<C>^e BEGIN INITIAL;\n",
+		"<C>[a-z]+ printf(\"C(%s) \", yytext);\n",
+		"<C>.|\\n ;\n",
+		"[a-z]+ printf(\"W(%s) \", yytext);\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) {\n",
+		"	yyin = stdin;\n",
+		"	while (yylex() > 0) ;\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "#if a #b\n#x ?#y\nc\nd e\ne f\n",
+			"D(#if) W(a) H(#b) D(#x) H(#y) C(d) C(e) W(f) "));
+}
+
+/* the body of a delimited token loops on everything but the delimiter, so
+ * the scanner skips ahead with yyaccel. it's also a memo state, since an
+ * unfinished token fails, and the skip mustn't make the memo miss it. */
+static void test_accel(void) {
+	static char *lex[] = {
+		" #define YY_STATS 1\n",
+		" #include <stdio.h>\n",
+		" #include <stdlib.h>\n",
+		" #include <string.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"\"<\"[^>]*\">\" printf(\"T(%ld) \", (long) yyleng);\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"static unsigned long walk(long n) {\n",
+		"	char *s = malloc(n + 1);\n",
+		"	memset(s, '<', n);\n",
+		"	s[n] = '\\0';\n",
+		"	memset(yystats(), 0, sizeof(struct yystats));\n",
+		"	yy_scan_string(s);\n",
+		"	while (yylex() > 0) ;\n",
+		"	free(s);\n",
+		"	return yystats()->backup;\n",
+		"}\n",
+		"int main(void) {\n",
+		"	unsigned long a, b;\n",
+		"	yyin = stdin;\n",
+		"	while (yylex() > 0) ;\n",
+		"	a = walk(2000);\n",
+		"	b = walk(8000);\n",
+		"	printf(\"%s\\n\", b < 8 * a ? \"linear\" : ",
+		"\"quadratic\");\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "<abc> x <d\ne> <<f>\n",
+			"T(5) T(5) T(4) linear\n"));
+	assert(file_contains(SCAN_DIR "scan.c", "yyaccel("));
+}
+
+/* keywords are looked up after the rule that's more general matches them,
+ * and the same word can be a keyword in more than one start condition */
+static void test_keywords(void) {
+	static char *lex[] = {
+		"%x X\n",
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"x BEGIN X;\n",
+		"<X>if printf(\"XIF \");\n",
+		"<X>y BEGIN INITIAL;\n",
+		"<X>[a-z]+ printf(\"XW(%s) \", yytext);\n",
+		"<X>.|\\n ;\n",
+		"if printf(\"IF \");\n",
+		"else printf(\"ELSE \");\n",
+		"[a-z]+ printf(\"W(%s) \", yytext);\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) {\n",
+		"	yyin = stdin;\n",
+		"	while (yylex() > 0) ;\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "if iff else x if iff else y if z\n",
+			"IF W(iff) ELSE XIF XW(iff) XW(else) IF W(z) "));
+}
+
+/* tokens that are split between chunks are picked up where they stopped */
+static void test_push(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"[a-z]+ return 1;\n",
+		"[0-9]+ return 2;\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) {\n",
+		"	char buf[256];\n",
+		"	long i, n;\n",
+		"	int r;\n",
+		"	n = (long) fread(buf, 1, sizeof(buf), stdin);\n",
+		"	for (i = 0; i < n; ++i) {\n",
+		"		r = yylex_push(buf + i, 1);\n",
+		"		for (; r > 0; r = yylex())\n",
+		"			printf(\"%d(%s) \", r, yytext);\n",
+		"		if (r != -YYERROR_NEED_MORE) return 1;\n",
+		"	}\n",
+		"	for (r = yylex_push(NULL, 0); r > 0; r = yylex())\n",
+		"		printf(\"%d(%s) \", r, yytext);\n",
+		"	printf(\"end %d\\n\", r);\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "foo 123 bar",
+			"1(foo) 2(123) 1(bar) end 0\n"));
+}
+
+/* in %pointer mode yytext points into the input buffer, which has to keep
+ * the start of a token while the rest of it is pushed a few bytes at a time */
+static void test_push_pointer(void) {
+	static char *lex[] = {
+		"%pointer\n",
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"[a-z]+ return 1;\n",
+		"[0-9]+ return 2;\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) {\n",
+		"	char buf[256];\n",
+		"	long i, n;\n",
+		"	int r;\n",
+		"	n = (long) fread(buf, 1, sizeof(buf), stdin);\n",
+		"	for (i = 0; i < n; i += 3) {\n",
+		"		r = yylex_push(buf + i, n - i < 3 ? n - i : ",
+		"3);\n",
+		"		for (; r > 0; r = yylex())\n",
+		"			printf(\"%d(%s) \", r, yytext);\n",
+		"		if (r != -YYERROR_NEED_MORE)\n",
+		"			return 1;\n",
+		"	}\n",
+		"	for (r = yylex_push(NULL, 0); r > 0; r = yylex())\n",
+		"		printf(\"%d(%s) \", r, yytext);\n",
+		"	printf(\"end %d\\n\", r);\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "", "hello 42 world x",
+			"1(hello) 2(42) 1(world) 1(x) end 0\n"));
+}
+
+/* an included file is read in the middle of the one that included it */
+static void test_include(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"@[a-z.\\/]+ {\n",
+		"	FILE *f = fopen(yytext + 1, \"r\");\n",
+		"	if (f == NULL || yypush_buffer(f) != 0) {\n",
+		"		return -1;\n",
+		"	}\n",
+		"}\n",
+		"[a-z]+ printf(\"%s \", yytext);\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) {\n",
+		"	if (yyin != stdin) { fclose(yyin); yyin = NULL; }\n",
+		"	return 1;\n",
+		"}\n",
+		"int main(void) {\n",
+		"	yyin = stdin;\n",
+		"	while (yylex() > 0) ;\n",
+		"	printf(\"end\\n\");\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(write_file(SCAN_DIR "scan.inc", "inner words\n"));
+	assert(scan_matches(lex, "", "one @" SCAN_DIR "scan.inc two\n",
+			"one inner words two end\n"));
+}
+
+/* includes nest, and yypop_buffer goes back to the including file early */
+static void test_include_nested(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"@[a-z0-9.\\/]+ {\n",
+		"	FILE *f = fopen(yytext + 1, \"r\");\n",
+		"	if (f == NULL || yypush_buffer(f) != 0) {\n",
+		"		return -1;\n",
+		"	}\n",
+		"}\n",
+		"! {\n",
+		"	FILE *f = yyin;\n",
+		"	if (yypop_buffer() != 0) {\n",
+		"		return -1;\n",
+		"	}\n",
+		"	fclose(f);\n",
+		"}\n",
+		"[a-z]+ printf(\"%s \", yytext);\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) {\n",
+		"	if (yyin != stdin) {\n",
+		"		fclose(yyin);\n",
+		"		yyin = NULL;\n",
+		"	}\n",
+		"	return 1;\n",
+		"}\n",
+		"int main(void) {\n",
+		"	yyin = stdin;\n",
+		"	while (yylex() > 0) ;\n",
+		"	printf(\"end\\n\");\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(write_file(SCAN_DIR "scan.inc", "a @" SCAN_DIR "scan.in2 b\n"));
+	assert(write_file(SCAN_DIR "scan.in2", "c ! d\n"));
+	assert(scan_matches(lex, "", "one @" SCAN_DIR "scan.inc two\n",
+			"one a c b two end\n"));
+}
+
+/* YY_STATS counts what the scanner does. REJECT gives the token back with
+ * yyless, so it counts towards rewind, and the bytes are counted again. */
+static void test_stats(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"abc REJECT;\n",
+		"[a-z]+ { if (yyleng > 3) yyless(3); }\n",
+		"[0-9]+\\.[0-9]+ ;\n",
+		"[0-9]+ ;\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(void) { return 1; }\n",
+		"int main(void) {\n",
+		"	yyin = stdin;\n",
+		"	while (yylex() > 0) ;\n",
+		"	yystats_dump(stdout);\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(scan_matches(lex, "-DYY_STATS", "abc abcdef 12.x\n",
+			"bytes 22\ntokens 10\nbackup 9\nrewind 6\n"
+			"refills 1\nrejects 1\n"
+			"rule 0 1\nrule 1 4\nrule 3 1\nrule 4 4\n"));
+}
+
+/* with YY_READAHEAD, a thread reads the blocks. the buffer here is small so
+ * there are a lot of them, and yywrap switches files, which restarts it. */
+static void test_readahead(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"[a-z]+ printf(\"%s \", yytext);\n",
+		"[0-9]+ printf(\"<%s> \", yytext);\n",
+		".|\\n ;\n",
+		"%%\n",
+		"static int files = 0;\n",
+		"int yywrap(void) {\n",
+		"	if (files++ > 0) {\n",
+		"		return 1;\n",
+		"	}\n",
+		"	yyin = fopen(\"" SCAN_DIR "scan.inc\", \"r\");\n",
+		"	return yyin == NULL;\n",
+		"}\n",
+		"int main(void) {\n",
+		"	yyin = stdin;\n",
+		"	while (yylex() > 0) ;\n",
+		"	printf(\"end\\n\");\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(write_file(SCAN_DIR "scan.inc", "second file 42\n"));
+	assert(scan_matches(lex,
+			POSIX_FLAGS " -DYY_READAHEAD -DYYBUF_SIZE=8 -pthread",
+			"the quick brown fox 1234567 jumps over the lazy "
+			"dog 99\n",
+			"the quick brown fox <1234567> jumps over the lazy dog "
+			"<99> second file <42> end\n"));
+}
+
+/* with YY_URING, stdin is read through an io_uring two small blocks at a
+ * time. words cross the blocks, and yywrap checks that the file offset was
+ * put back to the end of what the lexer took before switching files. */
+static void test_uring(void) {
+	static char *lex[] = {
+		" #include <stdio.h>\n",
+		" #include <unistd.h>\n",
+		" int yywrap(void);\n",
+		"%%\n",
+		"[a-z]+ printf(\"%s \", yytext);\n",
+		"[0-9]+ printf(\"<%s> \", yytext);\n",
+		".|\\n ;\n",
+		"%%\n",
+		"static int files = 0;\n",
+		"int yywrap(void) {\n",
+		"	if (files++ > 0) {\n",
+		"		return 1;\n",
+		"	}\n",
+		"	printf(\"@%ld \", (long) lseek(0, 0, SEEK_CUR));\n",
+		"	yyin = fopen(\"" SCAN_DIR "scan.inc\", \"r\");\n",
+		"	return yyin == NULL;\n",
+		"}\n",
+		"int main(void) {\n",
+		"	yyin = stdin;\n",
+		"	while (yylex() > 0) ;\n",
+		"	printf(\"end\\n\");\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(write_file(SCAN_DIR "scan.inc", "second file 42\n"));
+	assert(scan_matches(lex, POSIX_FLAGS " -D_DEFAULT_SOURCE -DYY_URING "
+			"-DYYURING_SIZE=16 -DYYURING_DEPTH=2 -DYYBUF_SIZE=8",
+			"the quick brown fox 1234567 jumps over the lazy "
+			"dog 99\n",
+			"the quick brown fox <1234567> jumps over the lazy dog "
+			"<99> @55 second file <42> end\n"));
+}
+
+/* yylex_files hands the tokens of each file over in order, whether it has
+ * threads to spare or one per processor. a missing file only fails itself,
+ * and the callback returning something stops the rest. */
+static void test_files(void) {
+	static char *lex[] = {
+		"%option reentrant\n",
+		" #include <stdio.h>\n",
+		" int yywrap(yyscan_t yyscanner);\n",
+		"%%\n",
+		"[a-z]+ ;\n",
+		"[0-9]+ return 7;\n",
+		".|\\n ;\n",
+		"%%\n",
+		"int yywrap(yyscan_t yyscanner) {\n",
+		"	(void) yyscanner;\n",
+		"	return 1;\n",
+		"}\n",
+		"static int show(int file, struct yytoken *t, long len,\n",
+		"		int error, void *arg) {\n",
+		"	long i;\n",
+		"	printf(\"%d:\", file);\n",
+		"	for (i = 0; i < len; ++i)\n",
+		"		printf(\" %d/%ld/%d/%d\", t[i].rule, ",
+		"t[i].offset,\n",
+		"			t[i].length, t[i].value);\n",
+		"	printf(\" e%d\\n\", error == 0 ? 0 : 1);\n",
+		"	return file == *(int *) arg ? 9 : 0;\n",
+		"}\n",
+		"int main(void) {\n",
+		"	char *paths[] = {\n",
+		"		\"" SCAN_DIR "scan.f0\",\n",
+		"		\"" SCAN_DIR "scan.f1\",\n",
+		"		\"" SCAN_DIR "scan.none\",\n",
+		"		\"" SCAN_DIR "scan.f0\",\n",
+		"		\"" SCAN_DIR "scan.f3\",\n",
+		"		\"" SCAN_DIR "scan.f1\"\n",
+		"	};\n",
+		"	int last = 5, stop = 4;\n",
+		"	printf(\"r%d\\n\",\n",
+		"		yylex_files(paths, 6, 3, show, &last));\n",
+		"	printf(\"r%d\\n\",\n",
+		"		yylex_files(paths, 6, 0, show, &stop));\n",
+		"	return 0;\n",
+		"}\n",
+		NULL
+	};
+
+	assert(write_file(SCAN_DIR "scan.f0", "ab 12\nc"));
+	assert(write_file(SCAN_DIR "scan.f1", ""));
+	assert(write_file(SCAN_DIR "scan.f3", "x 345"));
+	assert(scan_matches(lex, POSIX_FLAGS " -DYY_FILES -pthread", "",
+			"0: 0/0/2/0 2/2/1/0 1/3/2/7 2/5/1/0 0/6/1/0 e0\n"
+			"1: e0\n2: e1\n"
+			"3: 0/0/2/0 2/2/1/0 1/3/2/7 2/5/1/0 0/6/1/0 e0\n"
+			"4: 0/0/1/0 2/1/1/0 1/2/3/7 e0\n5: e0\nr9\n"
+			"0: 0/0/2/0 2/2/1/0 1/3/2/7 2/5/1/0 0/6/1/0 e0\n"
+			"1: e0\n2: e1\n"
+			"3: 0/0/2/0 2/2/1/0 1/3/2/7 2/5/1/0 0/6/1/0 e0\n"
+			"4: 0/0/1/0 2/1/1/0 1/2/3/7 e0\nr9\n"));
+}
+
+/* generates a scanner from the lines of lex, builds it with the warnings the
+ * repo itself is built with plus cflags, runs it with input on stdin, and
+ * returns 1 if it prints exactly expected. the lines are separate strings
+ * since ansi c doesn't promise that long ones work. */
+static int scan_matches(char **lex, char *cflags, char *input,
+		char *expected) {
+	struct stone_parse_state state;
+	FILE *f;
+	char *p, out[4096], cmd[512];
+	size_t n;
+	int ok;
+
+	if ((f = fopen(SCAN_DIR "scan.c", "w")) == NULL) {
+		return 0;
+	}
+	stone_parse_char(&state, COROUTINE_RESET, f);
+	for (ok = 1; *lex != NULL && ok; ++lex) {
+		for (p = *lex; *p && ok; ++p) {
+			ok = stone_parse_char(&state, (unsigned char) *p, f)
+				== 0;
+		}
+	}
+	ok = ok && stone_parse_char(&state, COROUTINE_EOF, f) == -1;
+	fclose(f);
+	if (!ok || !write_file(SCAN_DIR "scan.in", input) ||
+			strlen(cflags) > sizeof(cmd) / 2) {
+		return 0;
+	}
+
+	sprintf(cmd, "cc -Wall -Wextra -Wpedantic -Werror -ansi %s -o "
+			SCAN_DIR "scan " SCAN_DIR "scan.c", cflags);
+	if (system(cmd) != 0 ||
+			system("./" SCAN_DIR "scan < " SCAN_DIR "scan.in > "
+				SCAN_DIR "scan.out") != 0) {
+		return 0;
+	}
+	if ((f = fopen(SCAN_DIR "scan.out", "r")) == NULL) {
+		return 0;
+	}
+	n = fread(out, 1, sizeof(out) - 1, f);
+	fclose(f);
+	out[n] = '\0';
+	return strcmp(out, expected) == 0;
+}
+
+static int write_file(char *path, char *s) {
+	FILE *f;
+	int ok;
+
+	if ((f = fopen(path, "w")) == NULL) {
+		return 0;
+	}
+	ok = fputs(s, f) != EOF;
+	return fclose(f) == 0 && ok;
+}
+
+/* returns 1 if the file at path has s in it */
+static int file_contains(char *path, char *s) {
+	FILE *f;
+	char *buf;
+	long n;
+	int ok;
+
+	if ((f = fopen(path, "rb")) == NULL) {
+		return 0;
+	}
+	ok = fseek(f, 0, SEEK_END) == 0 && (n = ftell(f)) >= 0 &&
+		fseek(f, 0, SEEK_SET) == 0;
+	if (!ok || (buf = malloc((size_t) n + 1)) == NULL) {
+		fclose(f);
+		return 0;
+	}
+	buf[fread(buf, 1, (size_t) n, f)] = '\0';
+	fclose(f);
+	ok = strstr(buf, s) != NULL;
+	free(buf);
+	return ok;
+}
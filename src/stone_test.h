@@ -0,0 +1,6 @@
+#ifndef STONE_TEST_H
+#define STONE_TEST_H
+
+void test_stone(void);
+
+#endif
@@ -0,0 +1,2281 @@
+
+/* definitions */
+struct yyguts;
+typedef struct yyguts *yyscan_t;
+ #include <stdio.h>
+ int yywrap(yyscan_t yyscanner);
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+/* YY_POSIX is 1 if we can use posix functions like read(2) and mmap(2). it
+ * may be overwritten by the definitions section. strict ansi mode hides them
+ * unless they're asked for with a feature test macro. */
+#ifndef YY_POSIX
+#if ((defined(__unix__) || defined(__unix)) && \
+		(!defined(__STRICT_ANSI__) || defined(_POSIX_C_SOURCE))) || \
+		(defined(__APPLE__) && defined(__MACH__))
+#define YY_POSIX 1
+#else
+#define YY_POSIX 0
+#endif
+#endif
+
+#if YY_POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+/* YY_READAHEAD makes a helper thread call YY_INPUT, so that the next block of
+ * input is read while the lexer works on the one before it. it needs posix
+ * threads, so it's ignored without YY_POSIX. */
+#ifndef YY_READAHEAD
+#define YY_READAHEAD 0
+#elif !YY_POSIX
+#undef YY_READAHEAD
+#define YY_READAHEAD 0
+#endif
+
+/* YY_FILES adds yylex_files with %option reentrant, which lexes a list of
+ * files on a pool of threads. it's ignored without YY_POSIX. */
+#ifndef YY_FILES
+#define YY_FILES 0
+#elif !YY_POSIX
+#undef YY_FILES
+#define YY_FILES 0
+#endif
+
+#if YY_READAHEAD || YY_FILES
+#include <pthread.h>
+#endif
+
+/* YY_INPUT(buf, result, max) reads at most max bytes of yyin into buf, and
+ * sets result to the number of bytes read, 0 at the end of the file, or a
+ * negative number on error. it may be overwritten by the definitions section.
+ *
+ * IMPL-DEF: on unix-like systems the default uses read(2), which means that
+ * yyin shouldn't be read with stdio functions while the lexer is using it. */
+#ifndef YY_INPUT
+#if YY_POSIX
+#define YY_INPUT(buf, result, max) \
+	((result) = read(fileno(yyin), (buf), (max)))
+#define YY_INPUT_IS_READ 1
+#else
+#define YY_INPUT(buf, result, max) \
+	((result) = (long) fread((buf), 1, (max), yyin), \
+	 (result) = ((result) == 0 && ferror(yyin)) ? -1 : (result))
+#endif
+#endif
+
+/* YY_URING reads regular files with io_uring on linux, with a few blocks
+ * always being read ahead of the lexer. it's ignored when YY_INPUT has been
+ * redefined, and anything that io_uring can't be used for goes through
+ * YY_INPUT as usual. the system calls need _DEFAULT_SOURCE in strict ansi
+ * mode. */
+#ifndef YY_URING
+#define YY_URING 0
+#elif !YY_POSIX || !defined(__linux__) || !defined(__GNUC__) || \
+		!defined(YY_INPUT_IS_READ) || !defined(_DEFAULT_SOURCE)
+#undef YY_URING
+#define YY_URING 0
+#endif
+
+#if YY_URING
+#include <errno.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+#ifndef __NR_io_uring_setup
+#undef YY_URING
+#define YY_URING 0
+#endif
+#endif
+
+/* the static functions are there in case an action wants them, so most
+ * scanners leave some of them unused */
+#ifndef YY_UNUSED
+#ifdef __GNUC__
+#define YY_UNUSED __attribute__((unused))
+#else
+#define YY_UNUSED
+#endif
+#endif
+
+/* visibility macros, may be overwritten by the definitions section */
+#ifndef YYLEX_V
+#define YYLEX_V
+#endif
+
+#ifndef YYMORE_V
+#define YYMORE_V static YY_UNUSED
+#endif
+
+#ifndef YYLESS_V
+#define YYLESS_V static YY_UNUSED
+#endif
+
+#ifndef YYINPUT_V
+#define YYINPUT_V static YY_UNUSED
+#endif
+
+#ifndef YYUNPUT_V
+#define YYUNPUT_V static YY_UNUSED
+#endif
+
+#ifndef YYUNPUT_V
+#define YYUNPUT_V static YY_UNUSED
+#endif
+
+#ifndef YYTEXT_V
+#define YYTEXT_V
+#endif
+
+#ifndef YYIN_V
+#define YYIN_V
+#endif
+
+#ifndef YYOUT_V
+#define YYOUT_V
+#endif
+
+#ifndef YYLENG_V
+#define YYLENG_V
+#endif
+
+#ifndef YYLINENO_V
+#define YYLINENO_V
+#endif
+
+#ifndef YYRESET_V
+#define YYRESET_V static YY_UNUSED
+#endif
+
+#ifndef YYERROR_V
+#define YYERROR_V static YY_UNUSED
+#endif
+
+#ifndef YYMAP_V
+#define YYMAP_V static YY_UNUSED
+#endif
+
+#ifndef YYBATCH_V
+#define YYBATCH_V static YY_UNUSED
+#endif
+
+#ifndef YYSCAN_V
+#define YYSCAN_V static YY_UNUSED
+#endif
+
+#ifndef YYPUSH_V
+#define YYPUSH_V static YY_UNUSED
+#endif
+
+#ifndef YYBUFFER_V
+#define YYBUFFER_V static YY_UNUSED
+#endif
+
+#ifndef YYSTATS_V
+#define YYSTATS_V static YY_UNUSED
+#endif
+
+#ifndef YYFILES_V
+#define YYFILES_V static YY_UNUSED
+#endif
+
+/* variable definitions */
+
+/* you could change this value in the definitions section if you wanted to, but
+ * there's really no reason to do that instead of using %o */
+#ifndef YYTEXT_SIZE
+#define YYTEXT_SIZE 3000
+#endif
+
+/* the starting size of the input buffer, set with %option bufsize=n. it grows
+ * when a token and the lookahead needed to match it don't fit. */
+#ifndef YYBUF_SIZE
+#define YYBUF_SIZE 65536
+#endif
+
+#if YY_READAHEAD
+/* the size of each of the two blocks that the read-ahead thread fills */
+#ifndef YYAHEAD_SIZE
+#define YYAHEAD_SIZE YYBUF_SIZE
+#endif
+
+/* the read-ahead thread for one input. it fills slot[tail], then
+ * slot[tail ^ 1], and waits while both are full. yyfill copies out of
+ * slot[head] and empties it. len is 0 for an empty slot, and the thread stops
+ * for good when YY_INPUT returns 0 or less, which is saved in end. */
+struct yyring {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	FILE *in;
+	long len[2];
+	long pos;
+	long end;
+	int head;
+	int done;
+	int stop;
+	unsigned char slot[2][YYAHEAD_SIZE];
+};
+#endif
+
+#if YY_URING
+/* the number of reads kept going at once, and the size of each one */
+#ifndef YYURING_DEPTH
+#define YYURING_DEPTH 4
+#endif
+#ifndef YYURING_SIZE
+#define YYURING_SIZE YYBUF_SIZE
+#endif
+
+/* the io_uring for one input. block i is read from at[i] into buf + i *
+ * YYURING_SIZE, and the blocks are used in turn starting from head, so off is
+ * where the next one to be sent starts. res is what a finished read returned,
+ * and busy is set while it's in flight. unsent counts the reads that haven't
+ * been given to the kernel yet, and queued counts the ones that haven't
+ * finished, including those. ring is -1 if the input has to be read
+ * with YY_INPUT instead. */
+struct yyiouring {
+	int ring;
+	int fd;
+	int fixed;
+	int head;
+	int unsent;
+	int queued;
+	long pos;
+	long off;
+	long at[YYURING_DEPTH];
+	long res[YYURING_DEPTH];
+	int busy[YYURING_DEPTH];
+	struct iovec iov[YYURING_DEPTH];
+	unsigned char *buf;
+	unsigned char *map;
+	long map_len;
+	struct io_uring_sqe *sqes;
+	long sqes_len;
+	unsigned *sq_tail;
+	unsigned *sq_mask;
+	unsigned *sq_array;
+	unsigned *cq_head;
+	unsigned *cq_tail;
+	unsigned *cq_mask;
+	struct io_uring_cqe *cqes;
+};
+#endif
+
+/* a token found by yylex_batch. rule is the index of the rule that matched,
+ * counting from 0 in the order they're written, and offset is the number of
+ * bytes read before the token. value is what the action returned, or 0. */
+struct yytoken {
+	int rule;
+	int length;
+	long offset;
+	int value;
+};
+
+#if YY_FILES
+/* the tokens yylex_files found in a file, kept until the callback gets them.
+ * error is a YYERROR_* code, and done is set once the file has been lexed. */
+struct yyfile {
+	struct yytoken *tokens;
+	long len;
+	int error;
+	int done;
+};
+
+/* the work shared by yylex_files and its threads. files are taken in order,
+ * but only while they're fewer than ahead files past next, the next one for
+ * the callback, so that finished ones don't pile up. */
+struct yyfiles {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	char **paths;
+	struct yyfile *files;
+	int count;
+	int taken;
+	int next;
+	int ahead;
+	int stop;
+};
+#endif
+
+#define YYMEMO_CLEAR() ((void) 0)
+
+#ifdef YY_STATS
+/* with YY_STATS defined, the scanner counts what it does in one of these,
+ * see yystats. backup is the number of bytes the dfa read past the end of the
+ * tokens it found, and rewind is the number that yyless gave back. with
+ * YY_STATS defined as 2, cycles adds up YY_STATS_CLOCK() over each action. */
+#define YYSTATS_RULES 3
+struct yystats {
+	unsigned long bytes;
+	unsigned long tokens;
+	unsigned long backup;
+	unsigned long rewind;
+	unsigned long refills;
+	unsigned long rejects;
+	unsigned long rules[YYSTATS_RULES];
+#if YY_STATS > 1
+	unsigned long cycles[YYSTATS_RULES];
+#endif
+};
+
+#if YY_STATS > 1 && !defined(YY_STATS_CLOCK)
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define YY_STATS_CLOCK() ((unsigned long) __builtin_ia32_rdtsc())
+#else
+#include <time.h>
+#define YY_STATS_CLOCK() ((unsigned long) clock())
+#endif
+#endif
+#endif
+
+/* an input that yypush_buffer put on hold. the fields keep what the variables
+ * with the same names had, except data, which is the input buffer of the one
+ * that took its place. */
+struct yybuffer {
+	struct yybuffer *next;
+	FILE *in;
+	unsigned char *buf_data;
+	long buf_cap;
+	unsigned char *buf;
+	long buf_size;
+	long buf_pos;
+	long buf_len;
+	long buf_off;
+	long text_end;
+	int buf_fill;
+	int buf_ro;
+#if YY_POSIX
+	unsigned char *map_addr;
+	long map_len;
+	FILE *map_in;
+#endif
+	int anchor;
+#if YY_READAHEAD
+	struct yyring *ahead;
+#endif
+#if YY_URING
+	struct yyiouring *uring;
+#endif
+	unsigned char data[YYBUF_SIZE + 1];
+};
+
+/* with %option reentrant, everything that changes while scanning lives in a
+ * struct yyguts, and the usual names are macros for its members. every
+ * function takes the scanner as its last argument, and the tables are shared
+ * between all of them. */
+struct yyguts {
+	char yytext[YYTEXT_SIZE];
+	int yyleng;
+	FILE *yyin;
+	FILE *yyout;
+	void *yyextra; /* belongs to the user, see yyset_extra */
+
+	unsigned char yybuf_mem[YYBUF_SIZE + 1];
+	unsigned char *yybuf_data;
+	long yybuf_cap;
+	unsigned char *yybuf;
+	long yybuf_size;
+	long yybuf_pos;
+	long yybuf_len;
+	long yybuf_off;
+	long yytext_end;
+	int yybuf_fill;
+	int yybuf_ro;
+	int yybuf_eof;
+	struct yybuffer *yybuffers;
+#if YY_READAHEAD
+	struct yyring *yyahead;
+#endif
+#if YY_URING
+	struct yyiouring *yyuring;
+#endif
+#ifdef YY_STATS
+	struct yystats yystats_data;
+#if YY_STATS > 1
+	int yystats_rule;
+	unsigned long yystats_t0;
+#endif
+#endif
+#if YY_POSIX
+	unsigned char *yymap_addr;
+	long yymap_len;
+	FILE *yymap_in;
+#endif
+
+	int yystate;
+	int yyappend;
+	int yyanchor;
+
+	struct yytoken *yybatch;
+	int yybatch_len;
+	int yybatch_max;
+	int yybatch_act;
+
+	int yypush;
+	unsigned char *yypush_ptr;
+	long yypush_len;
+	long yywalk_cs;
+	long yywalk_len;
+	int yywalk_mid;
+	long yywalk_mlen;
+};
+
+#define yytext (yyg->yytext)
+#define yyleng (yyg->yyleng)
+#define yyin (yyg->yyin)
+#define yyout (yyg->yyout)
+#define yyextra (yyg->yyextra)
+#define yylineno (yyg->yylineno)
+#define yycolumn (yyg->yycolumn)
+#define yyoffset (yyg->yyoffset)
+#define yylines (yyg->yylines)
+#define yycol (yyg->yycol)
+#define yybuf_mem (yyg->yybuf_mem)
+#define yybuf_data (yyg->yybuf_data)
+#define yybuf_cap (yyg->yybuf_cap)
+#define yybuf (yyg->yybuf)
+#define yybuf_size (yyg->yybuf_size)
+#define yybuf_pos (yyg->yybuf_pos)
+#define yybuf_len (yyg->yybuf_len)
+#define yybuf_off (yyg->yybuf_off)
+#define yytext_end (yyg->yytext_end)
+#define yybuf_fill (yyg->yybuf_fill)
+#define yybuf_ro (yyg->yybuf_ro)
+#define yybuf_eof (yyg->yybuf_eof)
+#define yybuffers (yyg->yybuffers)
+#define yyahead (yyg->yyahead)
+#define yyuring (yyg->yyuring)
+#define yystats_data (yyg->yystats_data)
+#define yystats_rule (yyg->yystats_rule)
+#define yystats_t0 (yyg->yystats_t0)
+#define yymap_addr (yyg->yymap_addr)
+#define yymap_len (yyg->yymap_len)
+#define yymap_in (yyg->yymap_in)
+#define yyhold_pos (yyg->yyhold_pos)
+#define yyhold_char (yyg->yyhold_char)
+#define yystate (yyg->yystate)
+#define yyappend (yyg->yyappend)
+#define yyanchor (yyg->yyanchor)
+#define yybatch (yyg->yybatch)
+#define yybatch_len (yyg->yybatch_len)
+#define yybatch_max (yyg->yybatch_max)
+#define yybatch_act (yyg->yybatch_act)
+#define yypush (yyg->yypush)
+#define yypush_ptr (yyg->yypush_ptr)
+#define yypush_len (yyg->yypush_len)
+#define yywalk_cs (yyg->yywalk_cs)
+#define yywalk_len (yyg->yywalk_len)
+#define yywalk_mid (yyg->yywalk_mid)
+#define yywalk_mlen (yyg->yywalk_mlen)
+#define yywalk_mcs (yyg->yywalk_mcs)
+#define yymemo (yyg->yymemo)
+#define yymemo_cap (yyg->yymemo_cap)
+#define yymemo_len (yyg->yymemo_len)
+#define yymemo_hi (yyg->yymemo_hi)
+#define yymemo_gen (yyg->yymemo_gen)
+#define yymemo_eof (yyg->yymemo_eof)
+#define yycand (yyg->yycand)
+#define yycand_len (yyg->yycand_len)
+#define yycand_cap (yyg->yycand_cap)
+
+#define YY_ONLY_PARAM yyscan_t yyscanner
+#define YY_LAST_PARAM , yyscan_t yyscanner
+#define YY_ONLY_ARG yyscanner
+#define YY_LAST_ARG , yyscanner
+#define YY_G struct yyguts *yyg = yyscanner
+
+#define YYHOLD() ((void) 0)
+#define YYUNHOLD() ((void) 0)
+
+/* standard function definitions */
+YYLEX_V int yylex(YY_ONLY_PARAM);
+YYMORE_V int yymore(YY_ONLY_PARAM);
+YYLESS_V int yyless(int n YY_LAST_PARAM);
+YYINPUT_V int input(YY_ONLY_PARAM);
+YYUNPUT_V int unput(int c YY_LAST_PARAM);
+
+/* extension definitions */
+YYRESET_V int yyreset(YY_ONLY_PARAM);
+YYERROR_V char *yyerror(int code);
+YYBATCH_V int yylex_batch(struct yytoken *out, int max YY_LAST_PARAM);
+YYPUSH_V int yylex_push(char *chunk, long len YY_LAST_PARAM);
+#if YY_POSIX
+YYMAP_V int yymap(int fd YY_LAST_PARAM);
+YYMAP_V int yymap_path(char *path YY_LAST_PARAM);
+#endif
+YYSCAN_V int yy_scan_bytes(char *bytes, long len YY_LAST_PARAM);
+YYSCAN_V int yy_scan_string(char *str YY_LAST_PARAM);
+YYBUFFER_V int yypush_buffer(FILE *in YY_LAST_PARAM);
+YYBUFFER_V int yypop_buffer(YY_ONLY_PARAM);
+#ifdef YY_STATS
+YYSTATS_V struct yystats *yystats(YY_ONLY_PARAM);
+YYSTATS_V void yystats_dump(FILE *out YY_LAST_PARAM);
+#endif
+#if YY_FILES
+YYFILES_V int yylex_files(char **paths, int count, int threads,
+		int (*fn)(int file, struct yytoken *tokens, long len, int error,
+			void *arg), void *arg);
+#endif
+YYLEX_V int yylex_init(yyscan_t *scanner);
+YYLEX_V int yylex_destroy(yyscan_t yyscanner);
+YYLEX_V char *yyget_text(yyscan_t yyscanner);
+YYLEX_V int yyget_leng(yyscan_t yyscanner);
+YYLEX_V FILE *yyget_in(yyscan_t yyscanner);
+YYLEX_V void yyset_in(FILE *in, yyscan_t yyscanner);
+YYLEX_V FILE *yyget_out(yyscan_t yyscanner);
+YYLEX_V void yyset_out(FILE *out, yyscan_t yyscanner);
+YYLEX_V void *yyget_extra(yyscan_t yyscanner);
+YYLEX_V void yyset_extra(void *extra, yyscan_t yyscanner);
+
+/* helper functions */
+static long yyfill(YY_ONLY_PARAM); /* reads more input into yybuf */
+static int yytake(long n YY_LAST_PARAM); /* makes the next n bytes the token */
+static void yyclose(YY_ONLY_PARAM); /* lets go of the current input */
+#if YY_READAHEAD
+static long yyahead_read(unsigned char *buf, long max YY_LAST_PARAM);
+static void yyahead_stop(YY_ONLY_PARAM);
+#endif
+#if YY_URING
+static long yyuring_read(unsigned char *buf, long max YY_LAST_PARAM);
+static void yyuring_stop(YY_ONLY_PARAM);
+#endif
+static int yyown(YY_ONLY_PARAM); /* copies unconsumed input into yybuf_data */
+static int yygrow(long n YY_LAST_PARAM); /* makes yybuf_data hold n bytes */
+
+/* state definitions */
+#define INITIAL 0
+
+#define YYERROR_SUCCESS 0
+#define YYERROR_BUFF_FULL 1
+#define YYERROR_INV_ARG 2
+#define YYERROR_NO_MATCH 3
+#define YYERROR_READ 4
+#define YYERROR_NO_MEM 5
+#define YYERROR_NEED_MORE 6
+
+
+#ifdef YY_STATS
+#define YYSTATS_ADD(field, n) (yystats_data.field += (unsigned long) (n))
+#else
+#define YYSTATS_ADD(field, n) ((void) 0)
+#endif
+#if YY_STATS > 1
+#define YYSTATS_START(r) (yystats_rule = (r), yystats_t0 = YY_STATS_CLOCK())
+#define YYSTATS_STOP() do { \
+	if (yystats_rule >= 0) { \
+		yystats_data.cycles[yystats_rule] += \
+			YY_STATS_CLOCK() - yystats_t0; \
+		yystats_rule = -1; \
+	} \
+} while (0)
+#else
+#define YYSTATS_START(r) ((void) 0)
+#define YYSTATS_STOP() ((void) 0)
+#endif
+
+#define BEGIN yystate =
+#define ECHO fwrite(yytext, 1, (size_t) yyleng, yyout)
+
+/* scanner tables */
+typedef unsigned char yynode;
+
+static const unsigned char yy_ec[256] = {
+0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+};
+
+static const yynode yy_nxt[][5] = {
+{0},
+{0, 2, 3, 4, 5, },
+{0, 0, 0, 0, 0, },
+{0, 0, 0, 0, 0, },
+{0, 0, 0, 6, 0, },
+{0, 0, 0, 0, 7, },
+{0, 0, 0, 6, 0, },
+{0, 0, 0, 0, 7, },
+};
+
+static const yynode yy_start[1] = {
+1,
+};
+
+static const signed char yy_acclist[] = {
+-1,
+2, -1,
+1, 2, -1,
+0, 2, -1,
+1, -1,
+0, -1,
+};
+
+static const unsigned char yy_acc[] = {
+0,
+0,
+1,
+1,
+3,
+6,
+9,
+11,
+};
+
+static const char yy_skip[3] = {
+1,
+0,
+1,
+};
+
+
+
+
+
+static int yylex1(YY_ONLY_PARAM) {
+	int yyr, yymid;
+	long yyi, yyn, yymlen, yyoff, yyecho;
+	yynode yycs;
+	unsigned char *yyp, *yyend;
+	YY_G;
+
+	/* locals are prefixed since user actions share this scope */
+#define YYREWIND(len) do { \
+	if ((yyr = yyless(len YY_LAST_ARG)) != YYERROR_SUCCESS) { \
+		return -yyr; \
+	} \
+} while (0)
+
+	/* unmatched input is echoed a run at a time. the last yyecho bytes
+	 * before yybuf_pos haven't been written yet, and they have to be before
+	 * anything else is consumed or runs. */
+#define YYFLUSH() do { \
+	if (yyecho > 0) { \
+		YYFLUSH_COUNT(); \
+		fwrite(yybuf + yybuf_pos - yyecho, 1, (size_t) yyecho, yyout); \
+		yyecho = 0; \
+	} \
+} while (0)
+#define YYFLUSH_COUNT() ((void) 0)
+
+	yyecho = 0;
+	if (yyout == NULL) {
+		yyout = stdout;
+	}
+	yybuf_eof = 0;
+
+	/* pushed input ran out in the middle of a token last time, so the walk
+	 * carries on from where it stopped */
+	if (yywalk_cs != 0) {
+		yycs = (yynode) yywalk_cs;
+		yymid = yywalk_mid;
+		yymlen = yywalk_mlen;
+		yywalk_cs = 0;
+		YYUNHOLD();
+		yyp = yybuf + yybuf_pos + yywalk_len;
+		yyend = yybuf + yybuf_len;
+		goto yyresume;
+	}
+
+	/* every rule that doesn't return goes around this loop again, instead
+	 * of calling yylex1 and growing the stack */
+	for (;;) {
+
+		yymlen = yymid = -1;
+		yycs = yy_start[yystate];
+
+		YYUNHOLD();
+
+		/* the dfa walks the buffer without consuming anything, the
+		 * matched token is only consumed once we know how long it is */
+		yyp = yybuf + yybuf_pos;
+		yyend = yybuf + yybuf_len;
+	yyresume:
+		for (;;) {
+			if (yyp == yyend) {
+				YYFLUSH();
+				yyi = yyp - (yybuf + yybuf_pos);
+				yyn = yyfill(YY_ONLY_ARG);
+				if (yyn < 0) {
+					if (yyn == -YYERROR_NEED_MORE && yyi > 0) {
+						yywalk_cs = yycs;
+						yywalk_len = yyi;
+						yywalk_mid = yymid;
+						yywalk_mlen = yymlen;
+					}
+					return (int) yyn;
+				}
+				yyp = yybuf + yybuf_pos + yyi;
+				yyend = yybuf + yybuf_len;
+				if (yyn == 0) {
+					break;
+				}
+			}
+
+			yycs = yy_nxt[yycs][yy_ec[*yyp++]];
+			if (yycs == 0) {
+				break;
+			}
+
+			/* accept lists are sorted by priority, so the first rule
+			 * is the one we want */
+			if (yy_acclist[yy_acc[yycs]] >= 0) {
+				yymid = yy_acclist[yy_acc[yycs]];
+				yymlen = yyp - (yybuf + yybuf_pos);
+			}
+		}
+		YYSTATS_ADD(backup, (yyp - (yybuf + yybuf_pos)) -
+				(yymid < 0 ? 0 : yymlen));
+		if (yymid < 0) {
+			YYFLUSH();
+			if (yybuf_pos >= yybuf_len && yybuffers != NULL) {
+				/* an input from yypush_buffer is done, so the one
+				 * it interrupted carries on */
+				if ((yyr = yypop_buffer(YY_ONLY_ARG))
+						!= YYERROR_SUCCESS) {
+					return -yyr;
+				}
+				continue;
+			}
+			if (yybuf_pos >= yybuf_len) {
+				return 0;
+			}
+
+			/* nothing matched, so the first character gets copied to
+			 * the output and we try again from the one after it */
+			yyanchor = yybuf[yybuf_pos++] == '\n';
+			++yyecho;
+			YYSTATS_ADD(bytes, 1);
+			continue;
+		}
+		YYFLUSH();
+
+		/* rules with empty actions don't need yytext, so their input
+		 * is thrown away without leaving the loop */
+		if (yy_skip[yymid]) {
+			yyoff = yybuf_off + yybuf_pos;
+			yybuf_pos += yymlen;
+			yyanchor = yybuf[yybuf_pos - 1] == '\n';
+			YYSTATS_ADD(bytes, yymlen);
+			YYSTATS_ADD(tokens, 1);
+			YYSTATS_ADD(rules[yymid], 1);
+			if (yybatch != NULL) {
+				yybatch[yybatch_len].rule = yymid;
+				yybatch[yybatch_len].length = (int) yymlen;
+				yybatch[yybatch_len].offset = yyoff;
+				yybatch[yybatch_len].value = 0;
+				if (++yybatch_len == yybatch_max) {
+					return 0;
+				}
+			}
+			continue;
+		}
+
+		yyoff = yybuf_off + yybuf_pos;
+		if ((yyr = yytake(yymlen YY_LAST_ARG)) != YYERROR_SUCCESS) {
+			return -yyr;
+		}
+		YYSTATS_ADD(bytes, yymlen);
+		YYSTATS_ADD(tokens, 1);
+		YYSTATS_ADD(rules[yymid], 1);
+
+		if (yybatch != NULL) {
+			yybatch[yybatch_len].rule = yymid;
+			yybatch[yybatch_len].length = yyleng;
+			yybatch[yybatch_len].offset = yyoff;
+			yybatch[yybatch_len].value = 0;
+			++yybatch_len;
+			yybatch_act = 1;
+		}
+
+		yyanchor = yytext[yyleng-1] == '\n';
+
+		YYSTATS_START(yymid);
+		switch (yymid) {
+
+case 0:
+ ;
+goto yyskip;
+case 1:
+ return 7;
+goto yyskip;
+case 2:
+ ;
+goto yyskip;
+
+		default:
+			return 0;
+		}
+	yyskip:
+		YYSTATS_STOP();
+		if (yybatch != NULL) {
+			/* the action might have called yyless */
+			yybatch[yybatch_len - 1].length = yyleng;
+			yybatch_act = 0;
+			if (yybatch_len == yybatch_max) {
+				return 0;
+			}
+		}
+	}
+#undef YYREWIND
+#undef YYFLUSH
+#undef YYFLUSH_COUNT
+}
+
+#undef BEGIN
+#undef ECHO
+
+YYLEX_V int yylex(YY_ONLY_PARAM) {
+#if YY_STATS > 1
+	int r;
+	YY_G;
+
+	/* an action that returns doesn't get to yyskip */
+	r = yylex1(YY_ONLY_ARG);
+	YYSTATS_STOP();
+	return r;
+#else
+	return yylex1(YY_ONLY_ARG);
+#endif
+}
+
+/* runs the scanner until max tokens have been found, an action returns, or the
+ * input runs out. returns the number of tokens written to out, or a negative
+ * error code if there weren't any before the error. */
+YYBATCH_V int yylex_batch(struct yytoken *out, int max YY_LAST_PARAM) {
+	int r;
+	YY_G;
+
+	if (out == NULL || max <= 0) {
+		return -YYERROR_INV_ARG;
+	}
+
+	yybatch = out;
+	yybatch_len = 0;
+	yybatch_max = max;
+	yybatch_act = 0;
+	r = yylex1(YY_ONLY_ARG);
+	YYSTATS_STOP();
+	yybatch = NULL;
+
+	if (yybatch_act) {
+		out[yybatch_len - 1].length = yyleng;
+		out[yybatch_len - 1].value = r;
+		yybatch_act = 0;
+	} else if (r < 0 && yybatch_len == 0) {
+		return r;
+	}
+	return yybatch_len;
+}
+
+/* scans input that's handed over a chunk at a time, for when blocking in
+ * YY_INPUT isn't an option. the chunk is added to the input and the scanner
+ * runs like yylex, except that it returns -YYERROR_NEED_MORE once the input
+ * runs out, keeping any token that isn't finished yet. a NULL chunk means
+ * that there's no more input. */
+YYPUSH_V int yylex_push(char *chunk, long len YY_LAST_PARAM) {
+	int r;
+	YY_G;
+
+	if (len < 0 || (chunk == NULL && len != 0)) {
+		return -YYERROR_INV_ARG;
+	}
+	if (yypush_len != 0) {
+		/* the last chunk hasn't been used up yet */
+		return -YYERROR_INV_ARG;
+	}
+	YYUNHOLD();
+	if ((r = yyown(YY_ONLY_ARG)) != YYERROR_SUCCESS) {
+		return -r;
+	}
+	yybuf_fill = 1;
+	yypush = chunk == NULL ? 2 : 1;
+	yypush_ptr = (unsigned char *) chunk;
+	yypush_len = len;
+	r = yylex1(YY_ONLY_ARG);
+	YYSTATS_STOP();
+	return r;
+}
+
+YYMORE_V int yymore(YY_ONLY_PARAM) {
+	YY_G;
+	yyappend = 1;
+	return YYERROR_SUCCESS;
+}
+
+YYLESS_V int yyless(int n YY_LAST_PARAM) {
+	int i, r;
+	YY_G;
+
+	if (n < 0 || n > yyleng) {
+		return YYERROR_INV_ARG;
+	}
+	YYSTATS_ADD(rewind, yyleng - n);
+
+	YYUNHOLD();
+	if (yybuf_off + yybuf_pos == yytext_end) {
+		/* the token hasn't gone anywhere, so giving some of it back is
+		 * just moving yybuf_pos */
+		yybuf_pos -= yyleng - n;
+	} else {
+		/* the action has called input() or unput() */
+		for (i = yyleng-1; i >= n; --i) {
+			r = unput(yytext[i] YY_LAST_ARG);
+			if (r != YYERROR_SUCCESS) {
+				return r;
+			}
+		}
+	}
+	yytext_end = yybuf_off + yybuf_pos;
+	yytext[n] = '\0';
+	yyleng = n;
+	return YYERROR_SUCCESS;
+}
+
+YYINPUT_V int input(YY_ONLY_PARAM) {
+	YY_G;
+	YYUNHOLD();
+	if (yybuf_pos >= yybuf_len && yyfill(YY_ONLY_ARG) <= 0) {
+		return 0;
+	}
+	return yybuf[yybuf_pos++];
+}
+
+YYUNPUT_V int unput(int c YY_LAST_PARAM) {
+	int r;
+	YY_G;
+	YYUNHOLD();
+	if (yybuf_pos == 0 || yybuf_ro) {
+		if ((r = yyown(YY_ONLY_ARG)) != YYERROR_SUCCESS) {
+			return r;
+		}
+	}
+	if (yybuf_pos == 0) {
+		if (yybuf_len >= yybuf_size && (r = yygrow(yybuf_len + 1
+				YY_LAST_ARG)) != YYERROR_SUCCESS) {
+			return r;
+		}
+		memmove(yybuf + 1, yybuf, yybuf_len);
+		++yybuf_len;
+		++yybuf_pos;
+		--yybuf_off;
+	}
+	yybuf[--yybuf_pos] = c;
+	YYMEMO_CLEAR();
+	return YYERROR_SUCCESS;
+}
+
+YYRESET_V int yyreset(YY_ONLY_PARAM) {
+	YY_G;
+	YYUNHOLD();
+	while (yybuffers != NULL) {
+		yypop_buffer(YY_ONLY_ARG);
+	}
+	yyclose(YY_ONLY_ARG);
+	if (yybuf_cap > YYBUF_SIZE) {
+		free(yybuf_data);
+		yybuf_data = yybuf_mem;
+		yybuf_cap = YYBUF_SIZE;
+	}
+	yybuf = yybuf_data;
+	yybuf_size = yybuf_cap;
+	yybuf_pos = 0;
+	yybuf_len = 0;
+	yybuf_off = 0;
+	yytext_end = -1;
+	yypush = 0;
+	yypush_ptr = NULL;
+	yypush_len = 0;
+	yywalk_cs = 0;
+	YYMEMO_CLEAR();
+	yystate = INITIAL;
+	yyappend = 0;
+	yyanchor = 1;
+#if YYRESET1_DEFINED
+	return yyreset1(YY_ONLY_ARG);
+#else
+	return YYERROR_SUCCESS;
+#endif
+}
+
+static void yyclose(YY_ONLY_PARAM) {
+	YY_G;
+	yybuf_pos = yybuf_len;
+	yyown(YY_ONLY_ARG);
+	yybuf_fill = 1;
+	yybuf_eof = 0;
+#if YY_URING
+	yyuring_stop(YY_ONLY_ARG);
+#endif
+#if YY_READAHEAD
+	yyahead_stop(YY_ONLY_ARG);
+#endif
+#if YY_POSIX
+	if (yymap_in != NULL) {
+		if (yyin == yymap_in) {
+			yyin = NULL;
+		}
+		fclose(yymap_in);
+		yymap_in = NULL;
+	}
+#endif
+}
+
+YYLEX_V int yylex_init(yyscan_t *scanner) {
+	struct yyguts *yyg;
+
+	if (scanner == NULL) {
+		return YYERROR_INV_ARG;
+	}
+	yyg = *scanner = malloc(sizeof(*yyg));
+	if (yyg == NULL) {
+		return YYERROR_NO_MEM;
+	}
+
+	yytext[0] = '\0';
+	yyleng = 0;
+	yyin = NULL;
+	yyout = stdout;
+	yyextra = NULL;
+	yybuffers = NULL;
+#if YY_READAHEAD
+	yyahead = NULL;
+#endif
+#if YY_URING
+	yyuring = NULL;
+#endif
+#ifdef YY_STATS
+	memset(&yystats_data, 0, sizeof(yystats_data));
+#if YY_STATS > 1
+	yystats_rule = -1;
+	yystats_t0 = 0;
+#endif
+#endif
+	yybuf_data = yybuf_mem;
+	yybuf_cap = YYBUF_SIZE;
+	yybuf = yybuf_data;
+	yybuf_size = YYBUF_SIZE;
+	yybuf_pos = 0;
+	yybuf_len = 0;
+	yybuf_off = 0;
+	yytext_end = -1;
+	yybuf_fill = 1;
+	yybuf_ro = 0;
+	yybuf_eof = 0;
+#if YY_POSIX
+	yymap_addr = NULL;
+	yymap_len = 0;
+	yymap_in = NULL;
+#endif
+	yystate = INITIAL;
+	yyappend = 0;
+	yyanchor = 1;
+	yybatch = NULL;
+	yybatch_len = 0;
+	yybatch_max = 0;
+	yybatch_act = 0;
+	yypush = 0;
+	yypush_ptr = NULL;
+	yypush_len = 0;
+	yywalk_cs = 0;
+	return YYERROR_SUCCESS;
+}
+
+YYLEX_V int yylex_destroy(yyscan_t yyscanner) {
+	YY_G;
+	if (yyscanner == NULL) {
+		return YYERROR_INV_ARG;
+	}
+	while (yybuffers != NULL) {
+		yypop_buffer(yyscanner);
+	}
+	yyclose(yyscanner);
+	if (yybuf_cap > YYBUF_SIZE) {
+		free(yybuf_data);
+	}
+	free(yyscanner);
+	return YYERROR_SUCCESS;
+}
+
+YYLEX_V char *yyget_text(yyscan_t yyscanner) {
+	YY_G;
+	return yytext;
+}
+
+YYLEX_V int yyget_leng(yyscan_t yyscanner) {
+	YY_G;
+	return yyleng;
+}
+
+YYLEX_V FILE *yyget_in(yyscan_t yyscanner) {
+	YY_G;
+	return yyin;
+}
+
+YYLEX_V void yyset_in(FILE *in, yyscan_t yyscanner) {
+	YY_G;
+	yyin = in;
+}
+
+YYLEX_V FILE *yyget_out(yyscan_t yyscanner) {
+	YY_G;
+	return yyout;
+}
+
+YYLEX_V void yyset_out(FILE *out, yyscan_t yyscanner) {
+	YY_G;
+	yyout = out;
+}
+
+YYLEX_V void *yyget_extra(yyscan_t yyscanner) {
+	YY_G;
+	return yyextra;
+}
+
+YYLEX_V void yyset_extra(void *extra, yyscan_t yyscanner) {
+	YY_G;
+	yyextra = extra;
+}
+
+YYERROR_V char *yyerror(int code) {
+	if (code > INT_MIN && code < 0) {
+		code = -code;
+	}
+	switch (code) {
+	case YYERROR_SUCCESS: return "Success";
+	case YYERROR_BUFF_FULL: return "Input buffer is full";
+	case YYERROR_INV_ARG: return "Invalid input";
+	case YYERROR_NO_MATCH: return "No matching rule";
+	case YYERROR_READ: return "Failed to read input";
+	case YYERROR_NO_MEM: return "Out of memory";
+	case YYERROR_NEED_MORE: return "Need more input";
+	default: return "Unknown error code";
+	}
+}
+
+/* moves the unconsumed input to the front of yybuf and fills the rest of it.
+ * returns the number of bytes read, 0 at the end of the input, or a negative
+ * error code. */
+static long yyfill(YY_ONLY_PARAM) {
+	long n;
+	YY_G;
+
+	if (yybuf_pos > 0 && yybuf == yybuf_data) {
+		memmove(yybuf, yybuf + yybuf_pos, yybuf_len - yybuf_pos);
+		yybuf_len -= yybuf_pos;
+		yybuf_off += yybuf_pos;
+		yybuf_pos = 0;
+	}
+
+	/* yywrap already said that this is the end */
+	if (yybuf_eof) {
+		return 0;
+	}
+
+	/* a mapped file or a string has no more input after it, so the only
+	 * thing we can do is move on to the next file */
+	if (!yybuf_fill) {
+		if (yywrap(YY_ONLY_ARG)) {
+			yybuf_eof = 1;
+			return 0;
+		}
+		if ((n = yyown(YY_ONLY_ARG)) != YYERROR_SUCCESS) {
+			return -n;
+		}
+		yybuf_fill = 1;
+	}
+
+	/* the token doesn't fit, so the buffer gets bigger */
+	if (yybuf_len >= yybuf_size && (n = yygrow(yybuf_len + 1 YY_LAST_ARG))
+			!= YYERROR_SUCCESS) {
+		return -n;
+	}
+
+	/* pushed input is copied in from the last chunk, and instead of
+	 * blocking we tell the caller to push some more */
+	if (yypush != 0) {
+		if (yypush_len == 0) {
+			if (yypush == 1) {
+				return -YYERROR_NEED_MORE;
+			}
+			return 0;
+		}
+		n = yybuf_size - yybuf_len;
+		if (n > yypush_len) {
+			n = yypush_len;
+		}
+		memcpy(yybuf + yybuf_len, yypush_ptr, n);
+		yypush_ptr += n;
+		yypush_len -= n;
+		YYSTATS_ADD(refills, 1);
+		yybuf_len += n;
+		return n;
+	}
+
+	for (;;) {
+#if YY_URING
+		n = yyuring_read(yybuf + yybuf_len, yybuf_size - yybuf_len
+				YY_LAST_ARG);
+#elif YY_READAHEAD
+		n = yyahead_read(yybuf + yybuf_len, yybuf_size - yybuf_len
+				YY_LAST_ARG);
+#else
+		YY_INPUT((char *) yybuf + yybuf_len, n, yybuf_size - yybuf_len);
+#endif
+		if (n > 0) {
+			yybuf_len += n;
+			YYSTATS_ADD(refills, 1);
+			return n;
+		}
+		if (n < 0) {
+			return -YYERROR_READ;
+		}
+		if (yywrap(YY_ONLY_ARG)) {
+			yybuf_eof = 1;
+			return 0;
+		}
+	}
+}
+
+#if YY_READAHEAD
+/* the read-ahead thread. it reads with YY_INPUT like yyfill would, but from
+ * the yyin it was started for, and it can only be cancelled while it's
+ * reading. */
+#undef yyin
+static void *yyahead_run(void *arg) {
+	struct yyring *a = arg;
+	FILE *yyin = a->in;
+	int tail = 0;
+	int old;
+	long n;
+
+	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old);
+	for (;;) {
+		pthread_mutex_lock(&a->lock);
+		while (a->len[tail] != 0 && !a->stop) {
+			pthread_cond_wait(&a->cond, &a->lock);
+		}
+		if (a->stop) {
+			pthread_mutex_unlock(&a->lock);
+			return NULL;
+		}
+		pthread_mutex_unlock(&a->lock);
+
+		pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, &old);
+		YY_INPUT((char *) a->slot[tail], n, YYAHEAD_SIZE);
+		pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &old);
+
+		pthread_mutex_lock(&a->lock);
+		if (n > 0) {
+			a->len[tail] = n;
+		} else {
+			a->end = n;
+			a->done = 1;
+		}
+		pthread_cond_signal(&a->cond);
+		pthread_mutex_unlock(&a->lock);
+		if (n <= 0) {
+			return NULL;
+		}
+		tail ^= 1;
+	}
+}
+#define yyin (yyg->yyin)
+
+/* reads at most max bytes into buf like YY_INPUT, from the read-ahead thread
+ * for yyin, which is started if it isn't running. if it can't be, YY_INPUT is
+ * called here instead. the thread is done with at the end of the input, so
+ * that yywrap can change yyin. */
+static long yyahead_read(unsigned char *buf, long max YY_LAST_PARAM) {
+	struct yyring *a;
+	long n;
+	YY_G;
+
+	if ((a = yyahead) == NULL) {
+		if ((a = malloc(sizeof(*a))) == NULL) {
+			YY_INPUT((char *) buf, n, max);
+			return n;
+		}
+		a->in = yyin;
+		a->len[0] = 0;
+		a->len[1] = 0;
+		a->pos = 0;
+		a->end = 0;
+		a->head = 0;
+		a->done = 0;
+		a->stop = 0;
+		if (pthread_mutex_init(&a->lock, NULL) != 0) {
+			free(a);
+			YY_INPUT((char *) buf, n, max);
+			return n;
+		}
+		if (pthread_cond_init(&a->cond, NULL) != 0) {
+			pthread_mutex_destroy(&a->lock);
+			free(a);
+			YY_INPUT((char *) buf, n, max);
+			return n;
+		}
+		if (pthread_create(&a->thread, NULL, yyahead_run, a) != 0) {
+			pthread_cond_destroy(&a->cond);
+			pthread_mutex_destroy(&a->lock);
+			free(a);
+			YY_INPUT((char *) buf, n, max);
+			return n;
+		}
+		yyahead = a;
+	}
+
+	pthread_mutex_lock(&a->lock);
+	while (a->len[a->head] == 0 && !a->done) {
+		pthread_cond_wait(&a->cond, &a->lock);
+	}
+	pthread_mutex_unlock(&a->lock);
+
+	/* the thread fills the slots in order, so if this one is empty then
+	 * so is the other one */
+	if (a->len[a->head] == 0) {
+		n = a->end;
+		yyahead_stop(YY_ONLY_ARG);
+		return n;
+	}
+
+	n = a->len[a->head] - a->pos;
+	if (n > max) {
+		n = max;
+	}
+	memcpy(buf, a->slot[a->head] + a->pos, n);
+	a->pos += n;
+	if (a->pos == a->len[a->head]) {
+		pthread_mutex_lock(&a->lock);
+		a->len[a->head] = 0;
+		pthread_cond_signal(&a->cond);
+		pthread_mutex_unlock(&a->lock);
+		a->head ^= 1;
+		a->pos = 0;
+	}
+	return n;
+}
+
+/* stops the read-ahead thread for the current input and throws away whatever
+ * it read */
+static void yyahead_stop(YY_ONLY_PARAM) {
+	struct yyring *a;
+	YY_G;
+
+	if ((a = yyahead) == NULL) {
+		return;
+	}
+	pthread_mutex_lock(&a->lock);
+	a->stop = 1;
+	pthread_cond_signal(&a->cond);
+	pthread_mutex_unlock(&a->lock);
+	pthread_cancel(a->thread);
+	pthread_join(a->thread, NULL);
+	pthread_cond_destroy(&a->cond);
+	pthread_mutex_destroy(&a->lock);
+	free(a);
+	yyahead = NULL;
+}
+#endif
+
+#if YY_URING
+#define YYURING_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define YYURING_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+/* queues a read of the next block into block i */
+static void yyuring_queue(struct yyiouring *u, int i) {
+	struct io_uring_sqe *sqe;
+	unsigned tail;
+
+	tail = *u->sq_tail;
+	sqe = &u->sqes[tail & *u->sq_mask];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->fd = u->fd;
+	sqe->off = (unsigned long) u->off;
+	if (u->fixed) {
+		sqe->opcode = IORING_OP_READ_FIXED;
+		sqe->addr = (unsigned long) u->iov[i].iov_base;
+		sqe->len = YYURING_SIZE;
+		sqe->buf_index = (unsigned short) i;
+	} else {
+		sqe->opcode = IORING_OP_READV;
+		sqe->addr = (unsigned long) &u->iov[i];
+		sqe->len = 1;
+	}
+	sqe->user_data = (unsigned long) i;
+	u->sq_array[tail & *u->sq_mask] = tail & *u->sq_mask;
+	YYURING_STORE(u->sq_tail, tail + 1);
+	u->at[i] = u->off;
+	u->off += YYURING_SIZE;
+	u->busy[i] = 1;
+	++u->unsent;
+	++u->queued;
+}
+
+/* sends the queued reads and waits for at least wait of them to finish, then
+ * writes down every read that has */
+static int yyuring_enter(struct yyiouring *u, unsigned wait) {
+	struct io_uring_cqe *cqe;
+	unsigned head;
+	long r;
+
+	while (u->unsent > 0 || wait > 0) {
+		r = syscall(__NR_io_uring_enter, u->ring, (unsigned) u->unsent,
+				wait, wait > 0 ? IORING_ENTER_GETEVENTS : 0,
+				NULL, 0);
+		if (r >= 0) {
+			u->unsent -= (int) r;
+			break;
+		}
+		if (errno != EINTR) {
+			return -1;
+		}
+	}
+	head = *u->cq_head;
+	while (head != YYURING_LOAD(u->cq_tail)) {
+		cqe = &u->cqes[head & *u->cq_mask];
+		u->res[cqe->user_data] = cqe->res;
+		u->busy[cqe->user_data] = 0;
+		--u->queued;
+		++head;
+	}
+	YYURING_STORE(u->cq_head, head);
+	return 0;
+}
+
+/* waits for every read in flight, so that their blocks can be reused */
+static int yyuring_drain(struct yyiouring *u) {
+	while (u->queued > 0) {
+		if (yyuring_enter(u, (unsigned) u->queued) != 0) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/* starts reading from off into every block */
+static int yyuring_fill(struct yyiouring *u) {
+	int i;
+
+	for (i = 0; i < YYURING_DEPTH; ++i) {
+		yyuring_queue(u, i);
+	}
+	u->head = 0;
+	u->pos = 0;
+	return yyuring_enter(u, 0);
+}
+
+/* sets up an io_uring for yyin if it's a regular file. the result has ring
+ * set to -1 if it can't be used, or it's NULL if there's no memory. */
+static struct yyiouring *yyuring_start(YY_ONLY_PARAM) {
+	struct yyiouring *u;
+	struct io_uring_params p;
+	struct stat st;
+	long off, len;
+	void *addr;
+	int i;
+	YY_G;
+
+	if ((u = malloc(sizeof(*u))) == NULL) {
+		return NULL;
+	}
+	u->ring = -1;
+	u->fd = fileno(yyin);
+	if (fstat(u->fd, &st) != 0 || !S_ISREG(st.st_mode) ||
+			(off = (long) lseek(u->fd, 0, SEEK_CUR)) < 0) {
+		return u;
+	}
+	memset(&p, 0, sizeof(p));
+	if ((u->ring = (int) syscall(__NR_io_uring_setup, YYURING_DEPTH, &p))
+			< 0) {
+		u->ring = -1;
+		return u;
+	}
+
+	/* the submission and completion rings share one mapping, which every
+	 * kernel that has IORING_OP_READV in it gives us */
+	if (!(p.features & IORING_FEAT_SINGLE_MMAP)) {
+		goto fail_ring;
+	}
+	u->map_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if (len > u->map_len) {
+		u->map_len = len;
+	}
+	addr = mmap(NULL, u->map_len, PROT_READ | PROT_WRITE, MAP_SHARED,
+			u->ring, IORING_OFF_SQ_RING);
+	if (addr == MAP_FAILED) {
+		goto fail_ring;
+	}
+	u->map = addr;
+	u->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	addr = mmap(NULL, u->sqes_len, PROT_READ | PROT_WRITE, MAP_SHARED,
+			u->ring, IORING_OFF_SQES);
+	if (addr == MAP_FAILED) {
+		goto fail_map;
+	}
+	u->sqes = addr;
+	u->sq_tail = (unsigned *) (u->map + p.sq_off.tail);
+	u->sq_mask = (unsigned *) (u->map + p.sq_off.ring_mask);
+	u->sq_array = (unsigned *) (u->map + p.sq_off.array);
+	u->cq_head = (unsigned *) (u->map + p.cq_off.head);
+	u->cq_tail = (unsigned *) (u->map + p.cq_off.tail);
+	u->cq_mask = (unsigned *) (u->map + p.cq_off.ring_mask);
+	u->cqes = (struct io_uring_cqe *) (u->map + p.cq_off.cqes);
+
+	if ((u->buf = malloc((size_t) YYURING_DEPTH * YYURING_SIZE)) == NULL) {
+		goto fail_sqes;
+	}
+	for (i = 0; i < YYURING_DEPTH; ++i) {
+		u->iov[i].iov_base = u->buf + (long) i * YYURING_SIZE;
+		u->iov[i].iov_len = YYURING_SIZE;
+	}
+
+	/* registered buffers count against RLIMIT_MEMLOCK on older kernels, so
+	 * readv into the same blocks will have to do if they're refused */
+	u->fixed = syscall(__NR_io_uring_register, u->ring,
+			IORING_REGISTER_BUFFERS, u->iov, YYURING_DEPTH) == 0;
+	u->unsent = 0;
+	u->queued = 0;
+	u->off = off;
+	if (yyuring_fill(u) != 0) {
+		if (yyuring_drain(u) == 0) {
+			free(u->buf);
+		}
+		goto fail_sqes;
+	}
+	return u;
+
+fail_sqes:
+	munmap(u->sqes, u->sqes_len);
+fail_map:
+	munmap(u->map, u->map_len);
+fail_ring:
+	close(u->ring);
+	u->ring = -1;
+	return u;
+}
+
+/* reads at most max bytes into buf like YY_INPUT, from the blocks the
+ * io_uring has read ahead. the io_uring is done with at the end of the input,
+ * so that yywrap can change yyin. */
+static long yyuring_read(unsigned char *buf, long max YY_LAST_PARAM) {
+	struct yyiouring *u;
+	long n, res;
+	YY_G;
+
+	if ((u = yyuring) == NULL) {
+		u = yyuring = yyuring_start(YY_ONLY_ARG);
+	}
+	if (u == NULL || u->ring < 0) {
+#if YY_READAHEAD
+		n = yyahead_read(buf, max YY_LAST_ARG);
+#else
+		YY_INPUT((char *) buf, n, max);
+#endif
+		if (n <= 0) {
+			yyuring_stop(YY_ONLY_ARG);
+		}
+		return n;
+	}
+
+	while (u->busy[u->head]) {
+		if (yyuring_enter(u, 1) != 0) {
+			return -1;
+		}
+	}
+	if ((res = u->res[u->head]) < 0) {
+		return -1;
+	}
+	n = res - u->pos;
+	if (n > max) {
+		n = max;
+	}
+	memcpy(buf, u->buf + (long) u->head * YYURING_SIZE + u->pos, n);
+	u->pos += n;
+	if (u->pos < res) {
+		return n;
+	}
+
+	/* a whole block means that the next one is where it should be, but
+	 * after a short one the rest have to be read again from where it
+	 * stopped, unless it's the end of the file */
+	if (res == YYURING_SIZE) {
+		yyuring_queue(u, u->head);
+		if (yyuring_enter(u, 0) != 0) {
+			return -1;
+		}
+		u->head = (u->head + 1) % YYURING_DEPTH;
+		u->pos = 0;
+	} else if (res == 0) {
+		yyuring_stop(YY_ONLY_ARG);
+	} else {
+		if (yyuring_drain(u) != 0) {
+			return -1;
+		}
+		u->off = u->at[u->head] + res;
+		if (yyuring_fill(u) != 0) {
+			return -1;
+		}
+	}
+	return n;
+}
+
+/* lets go of the io_uring for the current input. the file offset is put back
+ * to just after the last byte the lexer took, as if it had been using read.
+ * if the reads in flight can't be waited for, their blocks are leaked instead
+ * of being freed under them. */
+static void yyuring_stop(YY_ONLY_PARAM) {
+	struct yyiouring *u;
+	int r;
+	YY_G;
+
+	if ((u = yyuring) == NULL) {
+		return;
+	}
+	if (u->ring >= 0) {
+		r = yyuring_drain(u);
+		lseek(u->fd, u->at[u->head] + u->pos, SEEK_SET);
+		munmap(u->sqes, u->sqes_len);
+		munmap(u->map, u->map_len);
+		close(u->ring);
+		if (r == 0) {
+			free(u->buf);
+		}
+	}
+	free(u);
+	yyuring = NULL;
+}
+
+#undef YYURING_LOAD
+#undef YYURING_STORE
+#endif
+
+static int yytake(long n YY_LAST_PARAM) {
+	YY_G;
+	if (n >= YYTEXT_SIZE) {
+		return YYERROR_BUFF_FULL;
+	}
+	memcpy(yytext, yybuf + yybuf_pos, n);
+	yytext[n] = '\0';
+	yyleng = (int) n;
+	yybuf_pos += n;
+	yytext_end = yybuf_off + yybuf_pos;
+	return YYERROR_SUCCESS;
+}
+
+#undef INITIAL
+
+#if YY_POSIX
+YYMAP_V int yymap(int fd YY_LAST_PARAM) {
+	struct stat st;
+	long page, len;
+	void *addr;
+	int r;
+	YY_G;
+
+	if ((r = yyreset(YY_ONLY_ARG)) != YYERROR_SUCCESS) {
+		return r;
+	}
+
+	if (fstat(fd, &st) != 0) {
+		return YYERROR_READ;
+	}
+
+	/* pipes, terminals, and empty files all go through the normal input
+	 * buffer instead. the rest of the last page of a mapping is zeroed,
+	 * but if the file fills it exactly then there's no room for a '\0'
+	 * after the last token, so an anonymous page has to go after it. */
+	len = (long) st.st_size;
+	page = sysconf(_SC_PAGESIZE);
+	if (!S_ISREG(st.st_mode) || st.st_size <= 0 || st.st_size >= LONG_MAX
+#ifndef MAP_ANONYMOUS
+			|| page <= 0 || len % page == 0
+#endif
+			) {
+		fd = dup(fd);
+		if (fd < 0 || (yymap_in = fdopen(fd, "r")) == NULL) {
+			return YYERROR_READ;
+		}
+		yyin = yymap_in;
+		return YYERROR_SUCCESS;
+	}
+
+	/* the mapping is private and writable so that %pointer mode can
+	 * terminate yytext in place and unput() still works */
+#ifdef MAP_ANONYMOUS
+	if (page > 0 && len % page == 0) {
+		addr = mmap(NULL, len + page, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (addr == MAP_FAILED) {
+			return YYERROR_READ;
+		}
+		if (mmap(addr, len, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+			munmap(addr, len + page);
+			return YYERROR_READ;
+		}
+		yymap_len = len + page;
+	} else
+#endif
+	{
+		addr = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+				fd, 0);
+		if (addr == MAP_FAILED) {
+			return YYERROR_READ;
+		}
+		yymap_len = len;
+	}
+#ifdef POSIX_MADV_SEQUENTIAL
+	posix_madvise(addr, len, POSIX_MADV_SEQUENTIAL);
+#endif
+
+	yymap_addr = addr;
+	yybuf = yymap_addr;
+	yybuf_fill = 0;
+	yybuf_size = len;
+	yybuf_pos = 0;
+	yybuf_len = len;
+	return YYERROR_SUCCESS;
+}
+
+YYMAP_V int yymap_path(char *path YY_LAST_PARAM) {
+	int fd, r;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return YYERROR_READ;
+	}
+	r = yymap(fd YY_LAST_ARG);
+	close(fd);
+	return r;
+}
+#endif
+
+YYSCAN_V int yy_scan_bytes(char *bytes, long len YY_LAST_PARAM) {
+	int r;
+	YY_G;
+
+	if (bytes == NULL || len < 0) {
+		return YYERROR_INV_ARG;
+	}
+	if ((r = yyreset(YY_ONLY_ARG)) != YYERROR_SUCCESS) {
+		return r;
+	}
+	yybuf = (unsigned char *) bytes;
+	yybuf_size = len;
+	yybuf_len = len;
+	yybuf_fill = 0;
+	yybuf_ro = 1;
+	return YYERROR_SUCCESS;
+}
+
+YYSCAN_V int yy_scan_string(char *str YY_LAST_PARAM) {
+	if (str == NULL) {
+		return YYERROR_INV_ARG;
+	}
+	return yy_scan_bytes(str, (long) strlen(str) YY_LAST_ARG);
+}
+
+/* puts the current input on hold and starts reading from in, with an input
+ * buffer of its own. the old input is picked up again by yypop_buffer, or
+ * when in runs out. */
+YYBUFFER_V int yypush_buffer(FILE *in YY_LAST_PARAM) {
+	struct yybuffer *b;
+	YY_G;
+
+	if ((b = malloc(sizeof(*b))) == NULL) {
+		return YYERROR_NO_MEM;
+	}
+	YYUNHOLD();
+	b->next = yybuffers;
+	b->in = yyin;
+	b->buf_data = yybuf_data;
+	b->buf_cap = yybuf_cap;
+	b->buf = yybuf;
+	b->buf_size = yybuf_size;
+	b->buf_pos = yybuf_pos;
+	b->buf_len = yybuf_len;
+	b->buf_off = yybuf_off;
+	b->text_end = yytext_end;
+	b->buf_fill = yybuf_fill;
+	b->buf_ro = yybuf_ro;
+#if YY_POSIX
+	b->map_addr = yymap_addr;
+	b->map_len = yymap_len;
+	b->map_in = yymap_in;
+	yymap_addr = NULL;
+	yymap_len = 0;
+	yymap_in = NULL;
+#endif
+	b->anchor = yyanchor;
+#if YY_READAHEAD
+	b->ahead = yyahead;
+	yyahead = NULL;
+#endif
+#if YY_URING
+	b->uring = yyuring;
+	yyuring = NULL;
+#endif
+	yybuffers = b;
+
+	yyin = in;
+	yybuf_data = b->data;
+	yybuf_cap = YYBUF_SIZE;
+	yybuf = yybuf_data;
+	yybuf_size = YYBUF_SIZE;
+	yybuf_pos = 0;
+	yybuf_len = 0;
+	yybuf_off = 0;
+	yytext_end = -1;
+	yybuf_fill = 1;
+	yybuf_ro = 0;
+	yybuf_eof = 0;
+	yyanchor = 1;
+	YYMEMO_CLEAR();
+	return YYERROR_SUCCESS;
+}
+
+/* goes back to the input that the last yypush_buffer put on hold. the current
+ * one is thrown away, but its file isn't closed. */
+YYBUFFER_V int yypop_buffer(YY_ONLY_PARAM) {
+	struct yybuffer *b;
+	YY_G;
+
+	if ((b = yybuffers) == NULL) {
+		return YYERROR_INV_ARG;
+	}
+	YYUNHOLD();
+	yyclose(YY_ONLY_ARG);
+	if (yybuf_cap > YYBUF_SIZE) {
+		free(yybuf_data);
+	}
+	yybuffers = b->next;
+	yyin = b->in;
+	yybuf_data = b->buf_data;
+	yybuf_cap = b->buf_cap;
+	yybuf = b->buf;
+	yybuf_size = b->buf_size;
+	yybuf_pos = b->buf_pos;
+	yybuf_len = b->buf_len;
+	yybuf_off = b->buf_off;
+	yytext_end = b->text_end;
+	yybuf_fill = b->buf_fill;
+	yybuf_ro = b->buf_ro;
+	yybuf_eof = 0;
+#if YY_POSIX
+	yymap_addr = b->map_addr;
+	yymap_len = b->map_len;
+	yymap_in = b->map_in;
+#endif
+	yyanchor = b->anchor;
+#if YY_READAHEAD
+	yyahead = b->ahead;
+#endif
+#if YY_URING
+	yyuring = b->uring;
+#endif
+	free(b);
+	YYMEMO_CLEAR();
+	return YYERROR_SUCCESS;
+}
+
+#ifdef YY_STATS
+/* returns the counts kept since the scanner started. they aren't reset by
+ * yyreset, but they can be cleared with memset. */
+YYSTATS_V struct yystats *yystats(YY_ONLY_PARAM) {
+	YY_G;
+	return &yystats_data;
+}
+
+/* writes the counts to out, one per line, with a line for each rule that has
+ * matched anything */
+YYSTATS_V void yystats_dump(FILE *out YY_LAST_PARAM) {
+	int i;
+	YY_G;
+
+	fprintf(out, "bytes %lu\n", yystats_data.bytes);
+	fprintf(out, "tokens %lu\n", yystats_data.tokens);
+	fprintf(out, "backup %lu\n", yystats_data.backup);
+	fprintf(out, "rewind %lu\n", yystats_data.rewind);
+	fprintf(out, "refills %lu\n", yystats_data.refills);
+	fprintf(out, "rejects %lu\n", yystats_data.rejects);
+	for (i = 0; i < YYSTATS_RULES; ++i) {
+		if (yystats_data.rules[i] == 0) {
+			continue;
+		}
+#if YY_STATS > 1
+		fprintf(out, "rule %d %lu %lu\n", i, yystats_data.rules[i],
+				yystats_data.cycles[i]);
+#else
+		fprintf(out, "rule %d %lu\n", i, yystats_data.rules[i]);
+#endif
+	}
+}
+#endif
+
+#if YY_FILES
+/* a thread of yylex_files, with a scanner of its own */
+struct yyworker {
+	struct yyfiles *files;
+	yyscan_t scanner;
+	pthread_t thread;
+};
+
+/* lexes the file at path into f with yylex_batch */
+static void yyfiles_lex(char *path, struct yyfile *f, yyscan_t yyscanner) {
+	struct yytoken *t;
+	long cap = 0;
+	int n;
+
+	f->tokens = NULL;
+	f->len = 0;
+	if ((f->error = yymap_path(path, yyscanner)) != YYERROR_SUCCESS) {
+		return;
+	}
+	for (;;) {
+		if (f->len == cap) {
+			cap = cap == 0 ? 256 : cap * 2;
+			t = realloc(f->tokens, (size_t) cap * sizeof(*t));
+			if (t == NULL) {
+				f->error = YYERROR_NO_MEM;
+				break;
+			}
+			f->tokens = t;
+		}
+		n = yylex_batch(f->tokens + f->len, cap - f->len > INT_MAX ?
+				INT_MAX : (int) (cap - f->len), yyscanner);
+		if (n <= 0) {
+			f->error = n < 0 ? -n : YYERROR_SUCCESS;
+			break;
+		}
+		f->len += n;
+	}
+	yyreset(yyscanner);
+}
+
+static void *yyfiles_run(void *arg) {
+	struct yyworker *w = arg;
+	struct yyfiles *f = w->files;
+	int i;
+
+	pthread_mutex_lock(&f->lock);
+	for (;;) {
+		while (!f->stop && f->taken < f->count &&
+				f->taken >= f->next + f->ahead) {
+			pthread_cond_wait(&f->cond, &f->lock);
+		}
+		if (f->stop || f->taken == f->count) {
+			break;
+		}
+		i = f->taken++;
+		pthread_mutex_unlock(&f->lock);
+		yyfiles_lex(f->paths[i], &f->files[i], w->scanner);
+		pthread_mutex_lock(&f->lock);
+		f->files[i].done = 1;
+		pthread_cond_broadcast(&f->cond);
+	}
+	pthread_mutex_unlock(&f->lock);
+	return NULL;
+}
+
+/* lexes count files on threads threads, or one per processor if it's 0, each
+ * with a scanner of its own. fn is called on this thread for each file in
+ * order with the tokens yylex_batch found in it, and a YYERROR_* code for how
+ * it went. the tokens are freed once fn returns, and if it returns something
+ * other than 0, no more files are started and that's returned. if no threads
+ * can be started, the files are lexed here instead. */
+YYFILES_V int yylex_files(char **paths, int count, int threads,
+		int (*fn)(int file, struct yytoken *tokens, long len, int error,
+			void *arg), void *arg) {
+	struct yyfiles f;
+	struct yyworker *w;
+	yyscan_t s = NULL;
+	int i, n, r = 0;
+
+	if (paths == NULL || count < 0 || fn == NULL) {
+		return YYERROR_INV_ARG;
+	}
+	if (count == 0) {
+		return YYERROR_SUCCESS;
+	}
+	if (threads <= 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+		threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+		if (threads <= 0) {
+			threads = 1;
+		}
+	}
+	if (threads > count) {
+		threads = count;
+	}
+
+	if ((f.files = calloc((size_t) count, sizeof(*f.files))) == NULL) {
+		return YYERROR_NO_MEM;
+	}
+	if ((w = malloc((size_t) threads * sizeof(*w))) == NULL) {
+		free(f.files);
+		return YYERROR_NO_MEM;
+	}
+	if (pthread_mutex_init(&f.lock, NULL) != 0) {
+		free(w);
+		free(f.files);
+		return YYERROR_NO_MEM;
+	}
+	if (pthread_cond_init(&f.cond, NULL) != 0) {
+		pthread_mutex_destroy(&f.lock);
+		free(w);
+		free(f.files);
+		return YYERROR_NO_MEM;
+	}
+	f.paths = paths;
+	f.count = count;
+	f.taken = 0;
+	f.next = 0;
+	f.ahead = 4 * threads;
+	f.stop = 0;
+
+	for (n = 0; n < threads; ++n) {
+		w[n].files = &f;
+		if (yylex_init(&w[n].scanner) != YYERROR_SUCCESS) {
+			break;
+		}
+		yyset_extra(arg, w[n].scanner);
+		if (pthread_create(&w[n].thread, NULL, yyfiles_run, &w[n])
+				!= 0) {
+			yylex_destroy(w[n].scanner);
+			break;
+		}
+	}
+	if (n == 0) {
+		if ((r = yylex_init(&s)) != YYERROR_SUCCESS) {
+			f.stop = 1;
+		} else {
+			yyset_extra(arg, s);
+		}
+	}
+
+	for (i = 0; i < count && r == 0; ++i) {
+		if (n == 0) {
+			yyfiles_lex(paths[i], &f.files[i], s);
+			f.files[i].done = 1;
+		}
+		pthread_mutex_lock(&f.lock);
+		while (!f.files[i].done) {
+			pthread_cond_wait(&f.cond, &f.lock);
+		}
+		pthread_mutex_unlock(&f.lock);
+
+		r = fn(i, f.files[i].tokens, f.files[i].len, f.files[i].error,
+				arg);
+		free(f.files[i].tokens);
+		f.files[i].tokens = NULL;
+
+		pthread_mutex_lock(&f.lock);
+		f.next = i + 1;
+		f.stop = r != 0;
+		pthread_cond_broadcast(&f.cond);
+		pthread_mutex_unlock(&f.lock);
+	}
+
+	pthread_mutex_lock(&f.lock);
+	f.stop = 1;
+	pthread_cond_broadcast(&f.cond);
+	pthread_mutex_unlock(&f.lock);
+	for (i = 0; i < n; ++i) {
+		pthread_join(w[i].thread, NULL);
+		yylex_destroy(w[i].scanner);
+	}
+	if (s != NULL) {
+		yylex_destroy(s);
+	}
+	for (i = 0; i < count; ++i) {
+		free(f.files[i].tokens);
+	}
+	pthread_cond_destroy(&f.cond);
+	pthread_mutex_destroy(&f.lock);
+	free(w);
+	free(f.files);
+	return r;
+}
+#endif
+
+
+static int yyown(YY_ONLY_PARAM) {
+	long n;
+	YY_G;
+
+	if (yybuf == yybuf_data) {
+		return YYERROR_SUCCESS;
+	}
+
+	n = yybuf_len - yybuf_pos;
+	if (n > yybuf_cap) {
+		int r;
+		if ((r = yygrow(n YY_LAST_ARG)) != YYERROR_SUCCESS) {
+			return r;
+		}
+	}
+	memcpy(yybuf_data, yybuf + yybuf_pos, n);
+#if YY_POSIX
+	if (yymap_addr != NULL) {
+		munmap(yymap_addr, yymap_len);
+		yymap_addr = NULL;
+	}
+#endif
+
+	yybuf = yybuf_data;
+	yybuf_size = yybuf_cap;
+	yybuf_ro = 0;
+	yybuf_off += yybuf_pos;
+	yybuf_pos = 0;
+	yybuf_len = n;
+	return YYERROR_SUCCESS;
+}
+
+/* makes yybuf_data big enough for n bytes, keeping what's in it if it's the
+ * input buffer. the size doubles each time, so a long token is only copied a
+ * few times on its way in. */
+static int yygrow(long n YY_LAST_PARAM) {
+	unsigned char *p;
+	long cap;
+	YY_G;
+
+	for (cap = yybuf_cap; cap < n; cap *= 2) {
+		if (cap > (LONG_MAX - 1) / 2) {
+			return YYERROR_NO_MEM;
+		}
+	}
+	if (cap == yybuf_cap) {
+		return YYERROR_SUCCESS;
+	}
+	if ((p = malloc((size_t) cap + 1)) == NULL) {
+		return YYERROR_NO_MEM;
+	}
+	if (yybuf == yybuf_data) {
+		memcpy(p, yybuf, yybuf_len);
+		yybuf = p;
+		yybuf_size = cap;
+	}
+	if (yybuf_cap > YYBUF_SIZE) {
+		free(yybuf_data);
+	}
+	yybuf_data = p;
+	yybuf_cap = cap;
+	return YYERROR_SUCCESS;
+}
+
+#undef yytext
+#undef yyleng
+#undef yyin
+#undef yyout
+#undef yyextra
+#undef yylineno
+#undef yycolumn
+#undef yyoffset
+#undef yylines
+#undef yycol
+#undef yybuf_mem
+#undef yybuf_data
+#undef yybuf_cap
+#undef yybuf
+#undef yybuf_size
+#undef yybuf_pos
+#undef yybuf_len
+#undef yybuf_off
+#undef yytext_end
+#undef yybuf_fill
+#undef yybuf_ro
+#undef yybuf_eof
+#undef yybuffers
+#undef yyahead
+#undef yyuring
+#undef yystats_data
+#undef yystats_rule
+#undef yystats_t0
+#undef yymap_addr
+#undef yymap_len
+#undef yymap_in
+#undef yyhold_pos
+#undef yyhold_char
+#undef yystate
+#undef yyappend
+#undef yyanchor
+#undef yybatch
+#undef yybatch_len
+#undef yybatch_max
+#undef yybatch_act
+#undef yypush
+#undef yypush_ptr
+#undef yypush_len
+#undef yywalk_cs
+#undef yywalk_len
+#undef yywalk_mid
+#undef yywalk_mlen
+#undef yywalk_mcs
+#undef yymemo
+#undef yymemo_cap
+#undef yymemo_len
+#undef yymemo_hi
+#undef yymemo_gen
+#undef yymemo_eof
+#undef yycand
+#undef yycand_len
+#undef yycand_cap
+
+/* user subroutines */
+int yywrap(yyscan_t yyscanner) {
+	(void) yyscanner;
+	return 1;
+}
+static int show(int file, struct yytoken *t, long len,
+		int error, void *arg) {
+	long i;
+	printf("%d:", file);
+	for (i = 0; i < len; ++i)
+		printf(" %d/%ld/%d/%d", t[i].rule, t[i].offset,
+			t[i].length, t[i].value);
+	printf(" e%d\n", error == 0 ? 0 : 1);
+	return file == *(int *) arg ? 9 : 0;
+}
+int main(void) {
+	char *paths[] = {
+		"work/scan.f0",
+		"work/scan.f1",
+		"work/scan.none",
+		"work/scan.f0",
+		"work/scan.f3",
+		"work/scan.f1"
+	};
+	int last = 5, stop = 4;
+	printf("r%d\n",
+		yylex_files(paths, 6, 3, show, &last));
+	printf("r%d\n",
+		yylex_files(paths, 6, 0, show, &stop));
+	return 0;
+}
+